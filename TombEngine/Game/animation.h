@@ -1,4 +1,6 @@
 #pragma once
+#include <memory_resource>
+
 #include "Math/Math.h"
 #include "Objects/game_object_ids.h"
 
@@ -29,9 +31,9 @@ enum class AnimCommandType
 
 struct AnimFrame
 {
-	GameBoundingBox			BoundingBox		 = GameBoundingBox::Zero;
-	Vector3					Offset			 = Vector3::Zero;
-	std::vector<Quaternion> BoneOrientations = {};
+	GameBoundingBox					BoundingBox			= GameBoundingBox::Zero;
+	Vector3							Offset				= Vector3::Zero;
+	std::pmr::vector<Quaternion>	BoneOrientations	= {}; // Level arena allocated for level frames.
 };
 
 struct StateDispatchData
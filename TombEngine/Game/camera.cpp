@@ -4,6 +4,7 @@
 #include "Game/animation.h"
 #include "Game/collision/collide_room.h"
 #include "Game/control/los.h"
+#include "Game/control/snapshot.h"
 #include "Game/effects/effects.h"
 #include "Game/effects/debris.h"
 #include "Game/effects/weather.h"
@@ -22,6 +23,7 @@
 
 using TEN::Renderer::g_Renderer;
 
+using namespace TEN::Control::Snapshot;
 using namespace TEN::Effects::Environment;
 using namespace TEN::Entities::Generic;
 using namespace TEN::Input;
@@ -96,6 +98,7 @@ void LookAt(CAMERA_INFO* cam, short roll)
 	float levelFarView = g_GameFlow->GetLevel(CurrentLevel)->GetFarView() * float(SECTOR(1));
 
 	g_Renderer.UpdateCameraMatrices(cam, r, fov, levelFarView);
+	RegisterCameraSnapshot(position, target, cam->pos.RoomNumber, r, fov, levelFarView);
 }
 
 void AlterFOV(short value, bool store)
@@ -1743,22 +1746,34 @@ std::vector<short> FillCollideableItemList()
 	std::vector<short> itemList;
 	auto& roomList = g_Level.Rooms[Camera.pos.RoomNumber].neighbors;
 
-	for (short i = 0; i < g_Level.NumItems; i++)
+	// Gather candidates from item lists of neighboring rooms instead of scanning all level items.
+	for (auto i : roomList)
 	{
-		auto* item = &g_Level.Items[i];
+		auto* room = &g_Level.Rooms[i];
 
-		if (std::find(roomList.begin(), roomList.end(), item->RoomNumber) == roomList.end())
+		if (!room->Active())
 			continue;
 
-		if (!g_Level.Rooms[item->RoomNumber].Active())
-			continue;
+		int linkCount = 0;
+		for (short itemNumber = room->itemNumber; itemNumber != NO_ITEM; itemNumber = g_Level.Items[itemNumber].NextItem)
+		{
+			// Stop at self-linked or cyclic item chain, as renderer item collection does.
+			if (itemNumber == g_Level.Items[itemNumber].NextItem || ++linkCount > (int)g_Level.Items.size())
+				break;
 
-		if (!CheckItemCollideCamera(&g_Level.Items[i]))
-			continue;
+			// Only level items are considered, as before.
+			if (itemNumber >= g_Level.NumItems)
+				continue;
 
-		itemList.push_back(i);
+			if (!CheckItemCollideCamera(&g_Level.Items[itemNumber]))
+				continue;
+
+			itemList.push_back(itemNumber);
+		}
 	}
 
+	// Keep item number order, so camera is pushed by overlapping items in same sequence.
+	std::sort(itemList.begin(), itemList.end());
 	return itemList;
 }
 
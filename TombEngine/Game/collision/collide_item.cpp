@@ -5,6 +5,7 @@
 #include "Game/control/los.h"
 #include "Game/collision/collide_room.h"
 #include "Game/collision/sphere.h"
+#include "Game/debug/profiler.h"
 #include "Game/effects/debris.h"
 #include "Game/effects/effects.h"
 #include "Game/effects/simple_particle.h"
@@ -1676,6 +1677,8 @@ void DoProjectileDynamics(short itemNumber, int x, int y, int z, int xv, int yv,
 
 void DoObjectCollision(ItemInfo* laraItem, CollisionInfo* coll)
 {
+	PROFILE_SCOPE_OBJECT("DoObjectCollision", laraItem->ObjectNumber, laraItem->Index);
+
 	laraItem->HitStatus = false;
 	coll->HitStatic     = false;
 
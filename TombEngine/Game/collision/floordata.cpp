@@ -1,6 +1,8 @@
 #include "framework.h"
 #include "Game/collision/floordata.h"
 
+#include <unordered_map>
+
 #include "Game/items.h"
 #include "Game/room.h"
 #include "Math/Math.h"
@@ -10,6 +12,11 @@
 using namespace TEN::Floordata;
 using namespace TEN::Math;
 
+// Side table of bridge item numbers referenced by FloorInfo::BridgeListIndex.
+// Lists are sorted, and emptied lists are recycled.
+static std::vector<std::vector<int>> BridgeLists			= {};
+static std::vector<int>				 FreeBridgeListIndices = {};
+
 int FloorInfo::GetSurfacePlaneIndex(int x, int z, bool isFloor) const
 {
 	// Calculate bias.
@@ -91,7 +98,7 @@ std::optional<int> FloorInfo::GetRoomNumberBelow(int x, int y, int z) const
 	int ceilingHeight = GetSurfaceHeight(x, z, false);
 
 	// Loop through bridges.
-	for (const int& i : BridgeItemNumbers)
+	for (const int& i : GetBridgeItemNumbers())
 	{
 		const auto& bridgeItem = g_Level.Items[i];
 		const auto& bridgeObject = Objects[bridgeItem.ObjectNumber];
@@ -132,7 +139,7 @@ std::optional<int> FloorInfo::GetRoomNumberAbove(int x, int y, int z) const
 	int ceilingHeight = GetSurfaceHeight(x, z, false);
 
 	// Loop through bridges.
-	for (const int& i : BridgeItemNumbers)
+	for (const int& i : GetBridgeItemNumbers())
 	{
 		const auto& bridgeItem = g_Level.Items[i];
 		const auto& bridgeObject = Objects[bridgeItem.ObjectNumber];
@@ -182,7 +189,7 @@ int FloorInfo::GetSurfaceHeight(int x, int y, int z, bool isFloor) const
 	int ceilingHeight = GetSurfaceHeight(x, z, false);
 
 	// Loop through bridges.
-	for (const int& i : BridgeItemNumbers)
+	for (const int& i : GetBridgeItemNumbers())
 	{
 		const auto& bridgeItem = g_Level.Items[i];
 		const auto& bridgeObject = Objects[bridgeItem.ObjectNumber];
@@ -220,7 +227,7 @@ int FloorInfo::GetSurfaceHeight(int x, int y, int z, bool isFloor) const
 int FloorInfo::GetBridgeSurfaceHeight(int x, int y, int z, bool isFloor) const
 {
 	// Loop through bridges.
-	for (const int& i : BridgeItemNumbers)
+	for (const int& i : GetBridgeItemNumbers())
 	{
 		const auto& bridgeItem = g_Level.Items[i];
 		const auto& bridgeObject = Objects[bridgeItem.ObjectNumber];
@@ -279,9 +286,19 @@ bool FloorInfo::IsWall(int x, int z) const
 	return IsWall(planeIndex);
 }
 
+const std::vector<int>& FloorInfo::GetBridgeItemNumbers() const
+{
+	static const auto NO_BRIDGES = std::vector<int>{};
+
+	if (BridgeListIndex == NO_BRIDGE_LIST)
+		return NO_BRIDGES;
+
+	return BridgeLists[BridgeListIndex];
+}
+
 int FloorInfo::GetInsideBridgeItemNumber(int x, int y, int z, bool testFloorBorder, bool testCeilingBorder) const
 {
-	for (const int& itemNumber : BridgeItemNumbers)
+	for (const int& itemNumber : GetBridgeItemNumbers())
 	{
 		const auto& bridgeItem = g_Level.Items[itemNumber];
 		const auto& bridgeObject = Objects[bridgeItem.ObjectNumber];
@@ -305,12 +322,42 @@ int FloorInfo::GetInsideBridgeItemNumber(int x, int y, int z, bool testFloorBord
 
 void FloorInfo::AddBridge(int itemNumber)
 {
-	BridgeItemNumbers.insert(itemNumber);
+	if (BridgeListIndex == NO_BRIDGE_LIST)
+	{
+		if (FreeBridgeListIndices.empty())
+		{
+			BridgeListIndex = (int)BridgeLists.size();
+			BridgeLists.emplace_back();
+		}
+		else
+		{
+			BridgeListIndex = FreeBridgeListIndices.back();
+			FreeBridgeListIndices.pop_back();
+		}
+	}
+
+	// Keep list sorted and unique, so bridges are iterated in same order as before.
+	auto& bridgeList = BridgeLists[BridgeListIndex];
+	auto it = std::lower_bound(bridgeList.begin(), bridgeList.end(), itemNumber);
+	if (it == bridgeList.end() || *it != itemNumber)
+		bridgeList.insert(it, itemNumber);
 }
 
 void FloorInfo::RemoveBridge(int itemNumber)
 {
-	BridgeItemNumbers.erase(itemNumber);
+	if (BridgeListIndex == NO_BRIDGE_LIST)
+		return;
+
+	auto& bridgeList = BridgeLists[BridgeListIndex];
+	auto it = std::lower_bound(bridgeList.begin(), bridgeList.end(), itemNumber);
+	if (it != bridgeList.end() && *it == itemNumber)
+		bridgeList.erase(it);
+
+	if (bridgeList.empty())
+	{
+		FreeBridgeListIndices.push_back(BridgeListIndex);
+		BridgeListIndex = NO_BRIDGE_LIST;
+	}
 }
 
 namespace TEN::Floordata
@@ -747,14 +794,17 @@ namespace TEN::Floordata
 		return location;
 	}
 
-	void AddBridge(int itemNumber, int x, int z)
+	// Collects rooms of sector and all sectors above and below which are spanned by bridge borders.
+	// Sector in each room is the one at given world position.
+	static std::vector<int> GetBridgeRoomNumbers(int itemNumber, int x, int z)
 	{
 		const auto& item = g_Level.Items[itemNumber];
-		x += item.Pose.Position.x;
-		z += item.Pose.Position.z;
 
-		auto floor = &GetFloorSide(item.RoomNumber, x, z);
-		floor->AddBridge(itemNumber);
+		auto roomNumbers = std::vector<int>{};
+
+		int roomNumber = item.RoomNumber;
+		auto floor = &GetFloorSide(roomNumber, x, z, &roomNumber);
+		roomNumbers.push_back(roomNumber);
 
 		const auto floorBorder = Objects[item.ObjectNumber].floorBorder(itemNumber);
 		while (floorBorder <= floor->GetSurfaceHeight(x, z, false))
@@ -763,8 +813,8 @@ namespace TEN::Floordata
 			if (!roomAbove)
 				break;
 
-			floor = &GetFloorSide(*roomAbove, x, z);
-			floor->AddBridge(itemNumber);
+			floor = &GetFloorSide(*roomAbove, x, z, &roomNumber);
+			roomNumbers.push_back(roomNumber);
 		}
 
 		const auto ceilingBorder = Objects[item.ObjectNumber].ceilingBorder(itemNumber);
@@ -774,41 +824,31 @@ namespace TEN::Floordata
 			if (!roomBelow)
 				break;
 
-			floor = &GetFloorSide(*roomBelow, x, z);
-			floor->AddBridge(itemNumber);
+			floor = &GetFloorSide(*roomBelow, x, z, &roomNumber);
+			roomNumbers.push_back(roomNumber);
 		}
+
+		return roomNumbers;
 	}
 
-	void RemoveBridge(int itemNumber, int x, int z)
+	void AddBridge(int itemNumber, int x, int z)
 	{
 		const auto& item = g_Level.Items[itemNumber];
 		x += item.Pose.Position.x;
 		z += item.Pose.Position.z;
 
-		auto floor = &GetFloorSide(item.RoomNumber, x, z);
-		floor->RemoveBridge(itemNumber);
-
-		const auto floorBorder = Objects[item.ObjectNumber].floorBorder(itemNumber);
-		while (floorBorder <= floor->GetSurfaceHeight(x, z, false))
-		{
-			const auto roomAbove = floor->GetRoomNumberAbove(x, z);
-			if (!roomAbove)
-				break;
-
-			floor = &GetFloorSide(*roomAbove, x, z);
-			floor->RemoveBridge(itemNumber);
-		}
+		for (int roomNumber : GetBridgeRoomNumbers(itemNumber, x, z))
+			GetFloor(roomNumber, x, z).AddBridge(itemNumber);
+	}
 
-		const auto ceilingBorder = Objects[item.ObjectNumber].ceilingBorder(itemNumber);
-		while (ceilingBorder >= floor->GetSurfaceHeight(x, z, true))
-		{
-			const auto roomBelow = floor->GetRoomNumberBelow(x, z);
-			if (!roomBelow)
-				break;
+	void RemoveBridge(int itemNumber, int x, int z)
+	{
+		const auto& item = g_Level.Items[itemNumber];
+		x += item.Pose.Position.x;
+		z += item.Pose.Position.z;
 
-			floor = &GetFloorSide(*roomBelow, x, z);
-			floor->RemoveBridge(itemNumber);
-		}
+		for (int roomNumber : GetBridgeRoomNumbers(itemNumber, x, z))
+			GetFloor(roomNumber, x, z).RemoveBridge(itemNumber);
 	}
 
 	// New function which gets precise floor/ceiling collision from actual object bounding box.
@@ -826,7 +866,7 @@ namespace TEN::Floordata
 
 		Vector3 pos = Vector3(x, y + (bottom ? 4 : -4), z); // Introduce slight vertical margin just in case
 
-		static float distance;
+		float distance = 0.0f;
 		if (dxBounds.Intersects(pos, (bottom ? -Vector3::UnitY : Vector3::UnitY), distance))
 			return std::optional{ item->Pose.Position.y + (bottom ? bounds.Y2 : bounds.Y1) };
 		else
@@ -843,6 +883,41 @@ namespace TEN::Floordata
 		return item->Pose.Position.y + (bottom ? bounds.Y2 : bounds.Y1);
 	}
 
+	// Sectors of bridge's own room which bridge is currently registered in, together with rooms of all sectors
+	// above and below which registration reached. Lets UpdateBridgeItem() touch only sectors whose state changed.
+	// Rooms are recorded instead of block pointers, as flipmaps reassign room block storage.
+	struct BridgeFootprint
+	{
+		struct Entry
+		{
+			int SectorIndex = 0;
+			int RoomNumber	= NO_ROOM;
+		};
+
+		int RoomNumber	  = NO_ROOM;
+		int FloorBorder	  = 0;
+		int CeilingBorder = 0;
+
+		std::vector<Entry> Entries = {}; // Sorted by sector index.
+	};
+
+	static std::unordered_map<int, BridgeFootprint> BridgeFootprints = {};
+
+	void ClearBridges()
+	{
+		BridgeFootprints.clear();
+		BridgeLists.clear();
+		FreeBridgeListIndices.clear();
+	}
+
+	static FloorInfo& GetBridgeFootprintFloor(const BridgeFootprint& footprint, const BridgeFootprint::Entry& entry)
+	{
+		const auto& room = g_Level.Rooms[footprint.RoomNumber];
+		int pX = room.x + ((entry.SectorIndex / room.zSize) * BLOCK(1)) + BLOCK(0.5f);
+		int pZ = room.z + ((entry.SectorIndex % room.zSize) * BLOCK(1)) + BLOCK(0.5f);
+		return GetFloor(entry.RoomNumber, pX, pZ);
+	}
+
 	// Updates BridgeItem for all blocks which are enclosed by bridge bounds.
 	void UpdateBridgeItem(int itemNumber, bool forceRemoval)
 	{
@@ -852,6 +927,54 @@ namespace TEN::Floordata
 		if (item->Flags & IFLAG_KILLED)
 			forceRemoval = true;
 
+		auto room = &g_Level.Rooms[item->RoomNumber];
+
+		auto footprintIt = BridgeFootprints.find(itemNumber);
+		if (footprintIt == BridgeFootprints.end())
+		{
+			// No footprint recorded yet; sweep whole room once to clean up any previous bridge state.
+			for (int x = 0; x < room->xSize; x++)
+			{
+				for (int z = 0; z < room->zSize; z++)
+				{
+					int pX = room->x + (x * BLOCK(1)) + BLOCK(0.5f);
+					int pZ = room->z + (z * BLOCK(1)) + BLOCK(0.5f);
+					RemoveBridge(itemNumber, pX - item->Pose.Position.x, pZ - item->Pose.Position.z);
+				}
+			}
+
+			footprintIt = BridgeFootprints.insert({ itemNumber, BridgeFootprint{} }).first;
+		}
+
+		auto& footprint = footprintIt->second;
+		int floorBorder = Objects[item->ObjectNumber].floorBorder(itemNumber);
+		int ceilingBorder = Objects[item->ObjectNumber].ceilingBorder(itemNumber);
+
+		// Sector indices are room-relative and vertical borders define which rooms above and below are reached,
+		// so if any of these changed, whole footprint must be re-registered.
+		if (forceRemoval ||
+			footprint.RoomNumber != item->RoomNumber ||
+			footprint.FloorBorder != floorBorder ||
+			footprint.CeilingBorder != ceilingBorder)
+		{
+			for (const auto& entry : footprint.Entries)
+				GetBridgeFootprintFloor(footprint, entry).RemoveBridge(itemNumber);
+
+			footprint.Entries.clear();
+		}
+
+		// If we're in sweeping mode, don't try to re-add blocks. Footprint is dropped, so that killed item
+		// number reused by another item doesn't inherit it.
+		if (forceRemoval)
+		{
+			BridgeFootprints.erase(footprintIt);
+			return;
+		}
+
+		footprint.RoomNumber = item->RoomNumber;
+		footprint.FloorBorder = floorBorder;
+		footprint.CeilingBorder = ceilingBorder;
+
 		// Get real OBB bounds of a bridge in world space
 		auto bounds = GameBoundingBox(item);
 		auto dxBounds = bounds.ToBoundingOrientedBox(item->Pose);
@@ -860,42 +983,61 @@ namespace TEN::Floordata
 		Vector3 corners[8];
 		dxBounds.GetCorners(corners); //corners[0], corners[1], corners[4] corners[5]
 
-		auto room = &g_Level.Rooms[item->RoomNumber];
-
 		// Get min/max of a projected AABB
-		auto minX = floor((std::min(std::min(std::min(corners[0].x, corners[1].x), corners[4].x), corners[5].x) - room->x) / BLOCK(1));
-		auto minZ = floor((std::min(std::min(std::min(corners[0].z, corners[1].z), corners[4].z), corners[5].z) - room->z) / BLOCK(1));
-		auto maxX =  ceil((std::max(std::max(std::max(corners[0].x, corners[1].x), corners[4].x), corners[5].x) - room->x) / BLOCK(1));
-		auto maxZ =  ceil((std::max(std::max(std::max(corners[0].z, corners[1].z), corners[4].z), corners[5].z) - room->z) / BLOCK(1));
-
-		// Run through all blocks enclosed in AABB
-		for (int x = 0; x < room->xSize; x++)
+		int minX = floor((std::min(std::min(std::min(corners[0].x, corners[1].x), corners[4].x), corners[5].x) - room->x) / BLOCK(1));
+		int minZ = floor((std::min(std::min(std::min(corners[0].z, corners[1].z), corners[4].z), corners[5].z) - room->z) / BLOCK(1));
+		int maxX =  ceil((std::max(std::max(std::max(corners[0].x, corners[1].x), corners[4].x), corners[5].x) - room->x) / BLOCK(1));
+		int maxZ =  ceil((std::max(std::max(std::max(corners[0].z, corners[1].z), corners[4].z), corners[5].z) - room->z) / BLOCK(1));
+
+		// Collect new footprint from blocks enclosed in AABB. Sector indices are generated in ascending order.
+		auto sectorIndices = std::vector<int>{};
+		for (int x = std::max(minX, 0); x <= std::min(maxX, room->xSize - 1); x++)
 		{
-			for (int z = 0; z < room->zSize; z++)
+			for (int z = std::max(minZ, 0); z <= std::min(maxZ, room->zSize - 1); z++)
 			{
+				// Construct a block bounding box within same plane as bridge bounding box and test intersection.
 				auto pX = room->x + (x * BLOCK(1)) + BLOCK(0.5f);
 				auto pZ = room->z + (z * BLOCK(1)) + BLOCK(0.5f);
-				auto offX = pX - item->Pose.Position.x;
-				auto offZ = pZ - item->Pose.Position.z;
+				auto blockBox = BoundingOrientedBox(Vector3(pX, dxBounds.Center.y, pZ), Vector3(BLOCK(1 / 2.0f)), Vector4::UnitY);
+				if (dxBounds.Intersects(blockBox))
+					sectorIndices.push_back((x * room->zSize) + z);
+			}
+		}
 
-				// Clean previous bridge state
-				RemoveBridge(itemNumber, offX, offZ);
+		// Diff old and new footprints. Both are sorted, so walk them in parallel.
+		auto entries = std::vector<BridgeFootprint::Entry>{};
+		entries.reserve(footprint.Entries.size());
 
-				// If we're in sweeping mode, don't try to re-add block
-				if (forceRemoval)
-					continue;
+		unsigned int entryIndex = 0;
+		for (int sectorIndex : sectorIndices)
+		{
+			// Remove bridge from sectors which are no longer covered.
+			while (entryIndex < footprint.Entries.size() && footprint.Entries[entryIndex].SectorIndex < sectorIndex)
+				GetBridgeFootprintFloor(footprint, footprint.Entries[entryIndex++]).RemoveBridge(itemNumber);
 
-				// If block isn't in enclosed AABB space, ignore precise check
-				if (x < minX || z < minZ || x > maxX || z > maxZ)
-					continue;
+			// Sector is still covered; keep its registration.
+			if (entryIndex < footprint.Entries.size() && footprint.Entries[entryIndex].SectorIndex == sectorIndex)
+			{
+				while (entryIndex < footprint.Entries.size() && footprint.Entries[entryIndex].SectorIndex == sectorIndex)
+					entries.push_back(footprint.Entries[entryIndex++]);
 
-				// Block is in enclosed AABB space, do more precise test.
-				// Construct a block bounding box within same plane as bridge bounding box and test intersection.
-				auto blockBox = BoundingOrientedBox(Vector3(pX, dxBounds.Center.y, pZ), Vector3(BLOCK(1 / 2.0f)), Vector4::UnitY);
-				if (dxBounds.Intersects(blockBox))
-					AddBridge(itemNumber, offX, offZ); // Intersects, try to add bridge to this block.
+				continue;
+			}
+
+			// Sector is newly covered; add bridge to it.
+			int pX = room->x + ((sectorIndex / room->zSize) * BLOCK(1)) + BLOCK(0.5f);
+			int pZ = room->z + ((sectorIndex % room->zSize) * BLOCK(1)) + BLOCK(0.5f);
+			for (int roomNumber : GetBridgeRoomNumbers(itemNumber, pX, pZ))
+			{
+				GetFloor(roomNumber, pX, pZ).AddBridge(itemNumber);
+				entries.push_back(BridgeFootprint::Entry{ sectorIndex, roomNumber });
 			}
 		}
+
+		while (entryIndex < footprint.Entries.size())
+			GetBridgeFootprintFloor(footprint, footprint.Entries[entryIndex++]).RemoveBridge(itemNumber);
+
+		footprint.Entries = std::move(entries);
 	}
 
 	bool TestMaterial(MaterialType refMaterial, const std::vector<MaterialType>& materialList)
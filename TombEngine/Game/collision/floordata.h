@@ -17,7 +17,7 @@ using namespace TEN::Math;
 
 constexpr auto WALL_PLANE = Vector3(0, 0, -CLICK(127));
 
-enum class MaterialType
+enum class MaterialType : unsigned char
 {
 	Mud = 0,
 	Snow = 1,
@@ -66,18 +66,25 @@ public:
 	std::array<Vector3, SURFACE_TRIANGLE_COUNT> Planes	= {};
 };
 
+// Flags are bit-packed to keep collision blocks compact.
 struct CollisionBlockFlagData
 {
-	bool Death		 = false;
-	bool Monkeyswing = false;
-	bool ClimbNorth	 = false;
-	bool ClimbSouth	 = false;
-	bool ClimbWest	 = false;
-	bool ClimbEast	 = false;
-	bool MarkBeetle	 = false;
-
-	bool MarkTriggerer		 = false;
-	bool MarkTriggererActive = false; // TODO: Must be written to and read from savegames.
+	bool Death		 : 1;
+	bool Monkeyswing : 1;
+	bool ClimbNorth	 : 1;
+	bool ClimbSouth	 : 1;
+	bool ClimbWest	 : 1;
+	bool ClimbEast	 : 1;
+	bool MarkBeetle	 : 1;
+
+	bool MarkTriggerer		 : 1;
+	bool MarkTriggererActive : 1; // TODO: Must be written to and read from savegames.
+
+	CollisionBlockFlagData() :
+		Death(false), Monkeyswing(false), ClimbNorth(false), ClimbSouth(false), ClimbWest(false), ClimbEast(false),
+		MarkBeetle(false), MarkTriggerer(false), MarkTriggererActive(false)
+	{
+	}
 
 	bool MinecartLeft() { return MarkTriggerer; }
 	bool MinecartRight() { return MarkBeetle; }
@@ -105,22 +112,28 @@ struct CollisionBlockFlagData
 };
 
 // Collision block
+// NOTE: One exists for every sector of every room, so members are ordered to avoid padding.
+// Bridges are rare, so their item numbers are kept in a shared side table instead of every block.
 class FloorInfo
 {
 	public:
+		// Constants
+		static constexpr auto NO_BRIDGE_LIST = -1;
+
 		// Components
-		int					   Room				 = 0; // RoomNumber
-		int					   WallPortal		 = 0; // Number of room through wall portal (only one)?
-		SurfaceCollisionData   FloorCollision	 = {};
-		SurfaceCollisionData   CeilingCollision  = {};
-		CollisionBlockFlagData Flags			 = {};
-		std::set<int>		   BridgeItemNumbers = {};
+		int					 Room			  = 0; // RoomNumber
+		int					 WallPortal		  = 0; // Number of room through wall portal (only one)?
+		SurfaceCollisionData FloorCollision	  = {};
+		SurfaceCollisionData CeilingCollision = {};
 
-		MaterialType Material = MaterialType::Stone;
+		int Box				= 0;
+		int TriggerIndex		= 0;
+		int TriggerRecordIndex	= -1;			  // Index into compiled level triggers.
+		int BridgeListIndex		= NO_BRIDGE_LIST; // Index into bridge side table.
 
-		int	 Box		  = 0;
-		int	 TriggerIndex = 0;
-		bool Stopper	  = true;
+		CollisionBlockFlagData Flags	= {};
+		MaterialType		   Material = MaterialType::Stone;
+		bool				   Stopper	= true;
 
 		// Getters
 		int		GetSurfacePlaneIndex(int x, int z, bool isFloor) const;
@@ -149,7 +162,8 @@ class FloorInfo
 		bool IsWall(int x, int z) const;
 
 		// Bridge methods
-		int	 GetInsideBridgeItemNumber(int x, int y, int z, bool floorBorder, bool ceilingBorder) const;
+		const std::vector<int>& GetBridgeItemNumbers() const;
+		int						GetInsideBridgeItemNumber(int x, int y, int z, bool floorBorder, bool ceilingBorder) const;
 		void AddBridge(int itemNumber);
 		void RemoveBridge(int itemNumber);
 };
@@ -183,6 +197,7 @@ namespace TEN::Floordata
 	std::optional<int> GetBridgeItemIntersect(int itemNumber, int x, int y, int z, bool bottom);
 	int				   GetBridgeBorder(int itemNumber, bool bottom);
 	void			   UpdateBridgeItem(int itemNumber, bool forceRemoval = false);
+	void			   ClearBridges();
 
 	bool TestMaterial(MaterialType refMaterial, const std::vector<MaterialType>& materialList);
 }
@@ -7,6 +7,7 @@
 #include "Game/collision/collide_room.h"
 #include "Game/control/control.h"
 #include "Game/control/lot.h"
+#include "Game/debug/profiler.h"
 #include "Game/effects/tomb4fx.h"
 #include "Game/itemdata/creature_info.h"
 #include "Game/Lara/lara.h"
@@ -976,6 +977,8 @@ bool UpdateLOT(LOTInfo* LOT, int depth)
 
 bool SearchLOT(LOTInfo* LOT, int depth)
 {
+	PROFILE_SCOPE("SearchLOT");
+
 	auto* zone = g_Level.Zones[(int)LOT->Zone][FlipStatus].data();
 	int searchZone = zone[LOT->Head];
 
@@ -1503,6 +1506,8 @@ void CreatureAIInfo(ItemInfo* item, AI_INFO* AI)
 	if (!item->IsCreature())
 		return;
 
+	PROFILE_SCOPE_OBJECT("CreatureAIInfo", item->ObjectNumber, item->Index);
+
 	auto* object = &Objects[item->ObjectNumber];
 	auto* creature = GetCreatureInfo(item);
 	auto* enemy = creature->Enemy;
@@ -1864,6 +1869,8 @@ void GetCreatureMood(ItemInfo* item, AI_INFO* AI, bool isViolent)
 
 TARGET_TYPE CalculateTarget(Vector3i* target, ItemInfo* item, LOTInfo* LOT)
 {
+	PROFILE_SCOPE_OBJECT("CalculateTarget", item->ObjectNumber, item->Index);
+
 	UpdateLOT(LOT, 5);
 
 	*target = item->Pose.Position;
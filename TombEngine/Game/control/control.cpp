@@ -8,8 +8,13 @@
 #include "Game/collision/collide_room.h"
 #include "Game/collision/sphere.h"
 #include "Game/control/flipeffect.h"
+#include "Game/control/jobs.h"
 #include "Game/control/lot.h"
+#include "Game/control/replay.h"
+#include "Game/control/scheduler.h"
+#include "Game/control/snapshot.h"
 #include "Game/control/volume.h"
+#include "Game/debug/profiler.h"
 #include "Game/effects/debris.h"
 #include "Game/effects/Blood.h"
 #include "Game/effects/Bubble.h"
@@ -46,18 +51,24 @@
 #include "Objects/TR5/Emitter/tr5_bats_emitter.h"
 #include "Objects/TR5/Emitter/tr5_rats_emitter.h"
 #include "Objects/TR5/Emitter/tr5_spider_emitter.h"
+#include "Objects/TR5/Object/tr5_pushableblock.h"
 #include "Scripting/Include/Flow/ScriptInterfaceFlowHandler.h"
 #include "Scripting/Include/Objects/ScriptInterfaceObjectsHandler.h"
 #include "Scripting/Include/ScriptInterfaceGame.h"
 #include "Scripting/Include/Strings/ScriptInterfaceStringsHandler.h"
 #include "Sound/sound.h"
 #include "Specific/clock.h"
+#include "Specific/configuration.h"
 #include "Specific/Input/Input.h"
 #include "Specific/level.h"
 #include "Specific/setup.h"
 #include "Specific/winmain.h"
 
 using namespace std::chrono;
+using namespace TEN::Control::Jobs;
+using namespace TEN::Control::Replay;
+using namespace TEN::Control::Scheduler;
+using namespace TEN::Control::Snapshot;
 using namespace TEN::Effects;
 using namespace TEN::Effects::Blood;
 using namespace TEN::Effects::Bubble;
@@ -105,23 +116,103 @@ short NextFxFree;
 
 int ControlPhaseTime;
 
+// Effect and swarm update stage. Besides own data, jobs declare shared state they touch.
+// Level geometry is not declared, as it is only read during stage.
+// Jobs are declared in order effects were updated serially, which is kept when parallel mode is off.
+static auto EffectStage = JobStage(
+{
+	{ "Weather.Update()", []() { Weather.Update(); }, Random::RandomStream::Gameplay,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_WEATHER | JOB_RESOURCE_RIPPLES | JOB_RESOURCE_SOUND },
+
+	// Visual effects draw from own random stream, except those which can harm player.
+	// Jobs which can damage player also declare sound and rumble written by DoDamage().
+	{ "StreamerEffect.Update()", []() { StreamerEffect.Update(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_STREAMERS },
+	{ "UpdateSparks()", []() { UpdateSparks(); }, Random::RandomStream::Gameplay,
+		JOB_RESOURCE_WEATHER, JOB_RESOURCE_PARTICLES | JOB_RESOURCE_ITEMS | JOB_RESOURCE_LIGHTS | JOB_RESOURCE_BUBBLES | JOB_RESOURCE_SOUND | JOB_RESOURCE_RUMBLE },
+	{ "UpdateFireSparks()", []() { UpdateFireSparks(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_FIRE_SPARKS },
+	{ "UpdateSmoke()", []() { UpdateSmoke(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_WEATHER, JOB_RESOURCE_SMOKE_SPARKS },
+	{ "UpdateBlood()", []() { UpdateBlood(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_BLOOD },
+	{ "UpdateBubbles()", []() { UpdateBubbles(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_BUBBLES | JOB_RESOURCE_RIPPLES },
+	{ "UpdateDebris()", []() { UpdateDebris(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_DEBRIS },
+	{ "UpdateGunShells()", []() { UpdateGunShells(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_GUNSHELLS | JOB_RESOURCE_DRIPS | JOB_RESOURCE_RIPPLES | JOB_RESOURCE_PARTICLES | JOB_RESOURCE_SOUND },
+	{ "UpdateFootprints()", []() { UpdateFootprints(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_FOOTPRINTS },
+	{ "UpdateSplashes()", []() { UpdateSplashes(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_SPLASHES },
+	{ "UpdateElectricityArcs()", []() { UpdateElectricityArcs(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_ELECTRICITY },
+	{ "UpdateHelicalLasers()", []() { UpdateHelicalLasers(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_ELECTRICITY },
+	{ "UpdateDrips()", []() { UpdateDrips(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_WEATHER, JOB_RESOURCE_DRIPS | JOB_RESOURCE_RIPPLES },
+
+	// Swarms can harm player, so they draw from gameplay random stream.
+	{ "UpdateRats()", []() { UpdateRats(); }, Random::RandomStream::Gameplay,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_RATS | JOB_RESOURCE_ITEMS | JOB_RESOURCE_PARTICLES | JOB_RESOURCE_RIPPLES | JOB_RESOURCE_SOUND },
+	{ "UpdateRipples()", []() { UpdateRipples(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_RIPPLES },
+	{ "UpdateBats()", []() { UpdateBats(); }, Random::RandomStream::Gameplay,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_BATS | JOB_RESOURCE_ITEMS | JOB_RESOURCE_BLOOD | JOB_RESOURCE_SOUND | JOB_RESOURCE_RUMBLE },
+	{ "UpdateSpiders()", []() { UpdateSpiders(); }, Random::RandomStream::Gameplay,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_SPIDERS | JOB_RESOURCE_ITEMS | JOB_RESOURCE_BLOOD | JOB_RESOURCE_SOUND | JOB_RESOURCE_RUMBLE },
+	{ "UpdateSparkParticles()", []() { UpdateSparkParticles(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_SPARK_PARTICLES },
+	{ "UpdateSmokeParticles()", []() { UpdateSmokeParticles(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_WEATHER, JOB_RESOURCE_SMOKE_PARTICLES },
+	{ "UpdateSimpleParticles()", []() { UpdateSimpleParticles(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_SIMPLE_PARTICLES },
+	{ "UpdateDrips()", []() { UpdateDrips(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_WEATHER, JOB_RESOURCE_DRIPS | JOB_RESOURCE_RIPPLES },
+	{ "UpdateExplosionParticles()", []() { UpdateExplosionParticles(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_EXPLOSION_PARTICLES },
+	{ "UpdateShockwaves()", []() { UpdateShockwaves(); }, Random::RandomStream::Gameplay,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_SHOCKWAVES | JOB_RESOURCE_PARTICLES | JOB_RESOURCE_ITEMS | JOB_RESOURCE_SOUND | JOB_RESOURCE_RUMBLE },
+	{ "UpdateBeetleSwarm()", []() { UpdateBeetleSwarm(); }, Random::RandomStream::Gameplay,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_BEETLES | JOB_RESOURCE_ITEMS },
+	{ "UpdateLocusts()", []() { UpdateLocusts(); }, Random::RandomStream::Gameplay,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_LOCUSTS | JOB_RESOURCE_ITEMS | JOB_RESOURCE_BLOOD | JOB_RESOURCE_SOUND | JOB_RESOURCE_RUMBLE },
+	{ "UpdateUnderwaterBloodParticles()", []() { UpdateUnderwaterBloodParticles(); }, Random::RandomStream::Effects,
+		JOB_RESOURCE_NONE, JOB_RESOURCE_UNDERWATER_BLOOD }
+});
+
 int DrawPhase(bool isTitle)
 {
+	PROFILE_SCOPE("DrawPhase");
+
+	// Drawing runs at variable rate, so it must never consume gameplay randomness.
+	auto streamScope = Random::RandomStreamScope(Random::RandomStream::Render);
+
 	if (isTitle)
 	{
-		g_Renderer.RenderTitle();
+		PROFILE_CALL(g_Renderer.RenderTitle());
 	}
 	else
 	{
-		g_Renderer.Render();
+		PROFILE_CALL(g_Renderer.Render());
 	}
 
-	Camera.numberFrames = g_Renderer.Synchronize();
+	PROFILE_SCOPE("Synchronize");
+
+	// With frame interpolation, presentation runs uncapped and logic catches up in ControlPhase.
+	if (g_Configuration.EnableFrameInterpolation)
+		Camera.numberFrames = g_FramePacer.WaitForTicks(0);
+	else
+		Camera.numberFrames = g_Renderer.Synchronize();
+
 	return Camera.numberFrames;
 }
 
 GameStatus ControlPhase(int numFrames)
 {
+	PROFILE_SCOPE("ControlPhase");
+
 	auto time1 = std::chrono::high_resolution_clock::now();
 
 	auto* level = g_GameFlow->GetLevel(CurrentLevel);
@@ -137,13 +228,25 @@ GameStatus ControlPhase(int numFrames)
 		AlterFOV(LastFOV);
 	}
 
-	g_GameStringsHandler->ProcessDisplayStrings(DELTA_TIME);
-	
+	// Display strings are submitted once per presented frame.
+	g_GameStringsHandler->DrawDisplayStrings();
+
 	bool isFirstTime = true;
 	static int framesCount = 0;
 
 	for (framesCount += numFrames; framesCount > 0; framesCount -= 2)
 	{
+		PROFILE_SCOPE("Tick");
+		g_InputReplay.BeginTick();
+
+		// With frame interpolation, number of ticks per presented frame varies. Joint transforms cached by
+		// renderer are dropped every tick, so logic queries never depend on presentation rate.
+		if (g_Configuration.EnableFrameInterpolation)
+			g_Renderer.ResetAnimations();
+
+		// Display strings are timed in logic ticks, so they don't speed up with uncapped presentation.
+		g_GameStringsHandler->UpdateDisplayStrings(DELTA_TIME);
+
 		// Controls are polled before OnControlPhase, so input data could be
 		// overwritten by script API methods.
 		HandleControls(isTitle);
@@ -151,7 +254,7 @@ GameStatus ControlPhase(int numFrames)
 		// This might not be the exact amount of time that has passed, but giving it a
 		// value of 1/30 keeps it in lock-step with the rest of the game logic,
 		// which assumes 30 iterations per second.
-		g_GameScript->OnControlPhase(DELTA_TIME);
+		PROFILE_CALL(g_GameScript->OnControlPhase(DELTA_TIME));
 
 		// Handle inventory / pause / load / save screens.
 		auto result = HandleMenuCalls(isTitle);
@@ -169,71 +272,43 @@ GameStatus ControlPhase(int numFrames)
 		ApplyActionQueue();
 		ClearActionQueue();
 
-		UpdateAllItems();
-		UpdateAllEffects();
-		UpdateLara(LaraItem, isTitle);
+		PROFILE_CALL(UpdateAllItems());
+		PROFILE_CALL(UpdateAllEffects());
+		PROFILE_CALL(UpdateLara(LaraItem, isTitle));
 
-		g_GameScriptEntities->TestCollidingObjects();
+		PROFILE_CALL(g_GameScriptEntities->TestCollidingObjects());
 
 		if (UseSpotCam)
 		{
 			// Draw flyby cameras.
-			CalculateSpotCameras();
+			PROFILE_CALL(CalculateSpotCameras());
 		}
 		else
 		{
 			// Do the standard camera.
 			TrackCameraInit = false;
-			CalculateCamera();
+			PROFILE_CALL(CalculateCamera());
 		}
 
 		// Update oscillator seed.
 		Wibble = (Wibble + WIBBLE_SPEED) & WIBBLE_MAX;
 
 		// Smash shatters and clear stopper flags under them.
-		UpdateShatters();
-
-		// Update weather.
-		Weather.Update();
-
-		// Update effects.
-		StreamerEffect.Update();
-		UpdateSparks();
-		UpdateFireSparks();
-		UpdateSmoke();
-		UpdateBlood();
-		UpdateBubbles();
-		UpdateDebris();
-		UpdateGunShells();
-		UpdateFootprints();
-		UpdateSplashes();
-		UpdateElectricityArcs();
-		UpdateHelicalLasers();
-		UpdateDrips();
-		UpdateRats();
-		UpdateRipples();
-		UpdateBats();
-		UpdateSpiders();
-		UpdateSparkParticles();
-		UpdateSmokeParticles();
-		UpdateSimpleParticles();
-		UpdateDrips();
-		UpdateExplosionParticles();
-		UpdateShockwaves();
-		UpdateBeetleSwarm();
-		UpdateLocusts();
-		UpdateUnderwaterBloodParticles();
+		PROFILE_CALL(UpdateShatters());
+
+		// Update weather, effects and swarms.
+		PROFILE_CALL(EffectStage.Run(g_Configuration.EnableParallelEffects));
 
 		// Update HUD.
-		g_Hud.Update(*LaraItem);
+		PROFILE_CALL(g_Hud.Update(*LaraItem));
 		UpdateFadeScreenAndCinematicBars();
 
 		// Rumble screen (like in submarine level of TRC).
 		if (g_GameFlow->GetLevel(CurrentLevel)->Rumble)
 			RumbleScreen();
 
-		PlaySoundSources();
-		DoFlipEffect(FlipEffect, LaraItem);
+		PROFILE_CALL(PlaySoundSources());
+		PROFILE_CALL(DoFlipEffect(FlipEffect, LaraItem));
 
 		// Clear savegame loaded flag.
 		JustLoaded = false;
@@ -242,6 +317,21 @@ GameStatus ControlPhase(int numFrames)
 		GameTimer++;
 		GlobalCounter++;
 
+		// Record or verify replay state.
+		g_InputReplay.EndTick();
+
+		// Capture render state for interpolated presentation. Logic time is measured in sync ticks
+		// and may run up to one tick ahead of last synchronisation.
+		// Without interpolation, snapshots are dropped, so that enabling it later doesn't blend against stale state.
+		if (g_Configuration.EnableFrameInterpolation)
+		{
+			PROFILE_CALL(CaptureRenderSnapshot(floor(g_FramePacer.GetLastSyncTime()) - (framesCount - 2)));
+		}
+		else
+		{
+			RenderSnapshots.Clear();
+		}
+
 		// Add renderer objects on the first processed frame.
 		if (isFirstTime)
 		{
@@ -290,6 +380,9 @@ GameStatus DoLevel(int levelIndex, bool loadGame)
 
 	TENLog(isTitle ? "DoTitle" : "DoLevel", LogLevel::Info);
 
+	// Start pending input recording or replay. RNG is seeded here, before level data is initialised.
+	g_InputReplay.BeginLevel(levelIndex, loadGame);
+
 	// Load the level. Fall back to title if unsuccessful.
 	if (!LoadLevelFile(levelIndex))
 		return isTitle ? GameStatus::ExitGame : GameStatus::ExitToTitle;
@@ -388,6 +481,7 @@ int GetRandomControl()
 
 int GetRandomDraw()
 {
+	auto streamScope = Random::RandomStreamScope(Random::RandomStream::Effects);
 	return Random::GenerateInt();
 }
 
@@ -404,10 +498,14 @@ void CleanUp()
 
 	// Needs to be cleared, otherwise a list of active creatures from previous level will spill into new level.
 	ActiveCreatures.clear();
+	g_ItemScheduler.Clear();
 
 	// Clear ropes.
 	Ropes.clear();
 
+	// Clear pushable stack index.
+	ClearStackIndex();
+
 	// Clear camera data.
 	ClearSpotCamSequences();
 	ClearCinematicBars();
@@ -433,6 +531,7 @@ void CleanUp()
 
 	// Clear all remaining renderer data.
 	g_Renderer.ClearScene();
+	RenderSnapshots.Clear();
 
 	// Reset Itemcamera
 	ClearObjCamera();
@@ -533,6 +632,8 @@ GameStatus DoGameLoop(int levelIndex)
 
 	while (DoTheGame)
 	{
+		PROFILE_BEGIN_FRAME();
+
 		result = ControlPhase(numFrames);
 
 		if (!levelIndex)
@@ -571,15 +672,19 @@ GameStatus DoGameLoop(int levelIndex)
 		}
 
 		numFrames = DrawPhase(!levelIndex);
-		Sound_UpdateScene();
+		PROFILE_CALL(Sound_UpdateScene());
+
+		PROFILE_END_FRAME();
 	}
 
+	PROFILE_END_FRAME();
 	EndGameLoop(levelIndex);
 	return result;
 }
 
 void EndGameLoop(int levelIndex)
 {
+	g_InputReplay.EndLevel();
 	DeInitialiseScripting(levelIndex);
 
 	StopAllSounds();
@@ -70,8 +70,6 @@ extern short NextFxFree;
 
 extern int ControlPhaseTime;
 
-extern std::vector<short> OutsideRoomTable[OUTSIDE_SIZE][OUTSIDE_SIZE];
-
 int DrawPhase(bool isTitle);
 
 GameStatus ControlPhase(int numFrames);
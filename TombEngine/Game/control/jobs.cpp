@@ -0,0 +1,114 @@
+#include "framework.h"
+#include "Game/control/jobs.h"
+
+#include <execution>
+
+#include "Game/debug/profiler.h"
+
+using namespace TEN::Math::Random;
+
+namespace TEN::Control::Jobs
+{
+	bool Job::TestConflict(const Job& job) const
+	{
+		return ((Writes & (job.Reads | job.Writes)) != 0 || (job.Writes & Reads) != 0);
+	}
+
+	JobStage::JobStage(const std::vector<Job>& jobs)
+	{
+		Jobs = jobs;
+		Seeds.resize(Jobs.size());
+		BuildWaves();
+	}
+
+	unsigned int JobStage::GetJobCount() const
+	{
+		return (unsigned int)Jobs.size();
+	}
+
+	unsigned int JobStage::GetWaveCount() const
+	{
+		return (unsigned int)Waves.size();
+	}
+
+	void JobStage::Run(bool isParallel)
+	{
+		// Seeds are drawn in declaration order regardless of mode.
+		for (int i = 0; i < Jobs.size(); i++)
+		{
+			auto& stream = GetStream(Jobs[i].Stream);
+			uint64_t high = stream.Next();
+			uint64_t low = stream.Next();
+			Seeds[i] = (high << 32) | low;
+		}
+
+		if (!isParallel)
+		{
+			for (int i = 0; i < Jobs.size(); i++)
+				RunJob(i);
+
+			return;
+		}
+
+		for (const auto& wave : Waves)
+		{
+			if (wave.size() == 1)
+			{
+				RunJob(wave.front());
+				continue;
+			}
+
+			std::for_each(
+				std::execution::par, wave.begin(), wave.end(),
+				[this](int jobIndex) { RunJob(jobIndex); });
+		}
+	}
+
+	void JobStage::BuildWaves()
+	{
+		// Each job is placed in wave after last wave holding earlier job it conflicts with.
+		auto jobWaves = std::vector<int>(Jobs.size());
+		Waves.clear();
+
+		for (int i = 0; i < Jobs.size(); i++)
+		{
+			int waveIndex = 0;
+			for (int j = 0; j < i; j++)
+			{
+				if (Jobs[i].TestConflict(Jobs[j]))
+					waveIndex = std::max(waveIndex, jobWaves[j] + 1);
+			}
+
+			jobWaves[i] = waveIndex;
+			if (waveIndex >= Waves.size())
+				Waves.resize(waveIndex + 1);
+
+			Waves[waveIndex].push_back(i);
+		}
+	}
+
+	void JobStage::RunJob(int jobIndex) const
+	{
+		const auto& job = Jobs[jobIndex];
+		PROFILE_SCOPE(job.Name);
+
+		// Bind job's own generators on current thread. Audio stream stays shared, as it is guarded by JOB_RESOURCE_SOUND.
+		auto generators = std::array<RandomGenerator, (int)RandomStream::Count>{};
+		for (int i = 0; i < generators.size(); i++)
+		{
+			if ((RandomStream)i == RandomStream::Audio)
+				continue;
+
+			generators[i].Seed(Seeds[jobIndex] + i);
+			BindThreadStream((RandomStream)i, &generators[i]);
+		}
+
+		{
+			auto streamScope = RandomStreamScope(job.Stream);
+			job.Update();
+		}
+
+		for (int i = 0; i < generators.size(); i++)
+			BindThreadStream((RandomStream)i, nullptr);
+	}
+}
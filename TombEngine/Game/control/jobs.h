@@ -0,0 +1,83 @@
+#pragma once
+#include <functional>
+
+#include "Math/Random.h"
+
+// Parallel job stage.
+// Every job declares shared state it reads and writes besides its own data. Jobs which don't conflict
+// are run concurrently, conflicting jobs keep their declaration order. Each job draws from its own
+// random generators seeded in declaration order, so serial and parallel runs give identical results.
+
+namespace TEN::Control::Jobs
+{
+	enum JobResourceFlags : unsigned long long
+	{
+		JOB_RESOURCE_NONE				 = 0,
+		JOB_RESOURCE_ITEMS				 = (1ull << 0), // Items, including player.
+		JOB_RESOURCE_SOUND				 = (1ull << 1), // Sound slots and audio random stream.
+		JOB_RESOURCE_LIGHTS				 = (1ull << 2), // Renderer dynamic lights.
+		JOB_RESOURCE_WEATHER			 = (1ull << 3),
+		JOB_RESOURCE_PARTICLES			 = (1ull << 4), // Legacy particles and particle dynamics.
+		JOB_RESOURCE_FIRE_SPARKS		 = (1ull << 5),
+		JOB_RESOURCE_SMOKE_SPARKS		 = (1ull << 6),
+		JOB_RESOURCE_BLOOD				 = (1ull << 7),
+		JOB_RESOURCE_UNDERWATER_BLOOD	 = (1ull << 8),
+		JOB_RESOURCE_BUBBLES			 = (1ull << 9),
+		JOB_RESOURCE_DEBRIS				 = (1ull << 10),
+		JOB_RESOURCE_GUNSHELLS			 = (1ull << 11),
+		JOB_RESOURCE_FOOTPRINTS			 = (1ull << 12),
+		JOB_RESOURCE_SPLASHES			 = (1ull << 13),
+		JOB_RESOURCE_ELECTRICITY		 = (1ull << 14),
+		JOB_RESOURCE_DRIPS				 = (1ull << 15),
+		JOB_RESOURCE_RIPPLES			 = (1ull << 16),
+		JOB_RESOURCE_SPARK_PARTICLES	 = (1ull << 17),
+		JOB_RESOURCE_SMOKE_PARTICLES	 = (1ull << 18),
+		JOB_RESOURCE_SIMPLE_PARTICLES	 = (1ull << 19),
+		JOB_RESOURCE_EXPLOSION_PARTICLES = (1ull << 20),
+		JOB_RESOURCE_SHOCKWAVES			 = (1ull << 21),
+		JOB_RESOURCE_STREAMERS			 = (1ull << 22),
+		JOB_RESOURCE_RATS				 = (1ull << 23),
+		JOB_RESOURCE_BATS				 = (1ull << 24),
+		JOB_RESOURCE_SPIDERS			 = (1ull << 25),
+		JOB_RESOURCE_BEETLES			 = (1ull << 26),
+		JOB_RESOURCE_LOCUSTS			 = (1ull << 27),
+		JOB_RESOURCE_RUMBLE				 = (1ull << 28)  // Controller rumble, set by player damage.
+	};
+
+	struct Job
+	{
+		const char*						 Name	= nullptr; // Must be a string literal.
+		std::function<void()>			 Update = nullptr;
+		TEN::Math::Random::RandomStream	 Stream = TEN::Math::Random::RandomStream::Gameplay;
+		unsigned long long				 Reads	= JOB_RESOURCE_NONE;
+		unsigned long long				 Writes = JOB_RESOURCE_NONE;
+
+		bool TestConflict(const Job& job) const;
+	};
+
+	class JobStage
+	{
+	private:
+		// Members
+		std::vector<Job>			  Jobs	= {};
+		std::vector<std::vector<int>> Waves = {}; // Job indices per wave. Jobs within wave don't conflict.
+		std::vector<uint64_t>		  Seeds = {};
+
+	public:
+		// Constructors
+		JobStage() = default;
+		JobStage(const std::vector<Job>& jobs);
+
+		// Getters
+		unsigned int GetJobCount() const;
+		unsigned int GetWaveCount() const;
+
+		// Utilities
+		void Run(bool isParallel);
+
+	private:
+		// Helpers
+		void BuildWaves();
+		void RunJob(int jobIndex) const;
+	};
+}
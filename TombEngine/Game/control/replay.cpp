@@ -0,0 +1,473 @@
+#include "framework.h"
+#include "Game/control/replay.h"
+
+#include <fstream>
+#include <random>
+
+#include "Game/control/control.h"
+#include "Game/effects/effects.h"
+#include "Game/items.h"
+#include "Math/Random.h"
+#include "Specific/level.h"
+
+using namespace TEN::Input;
+using namespace TEN::Math;
+
+namespace TEN::Control::Replay
+{
+	InputReplay g_InputReplay = {};
+
+	ReplayMode InputReplay::GetMode() const
+	{
+		return Mode;
+	}
+
+	unsigned int InputReplay::GetTick() const
+	{
+		return Tick;
+	}
+
+	bool InputReplay::IsRecording() const
+	{
+		return (Mode == ReplayMode::Record && IsRunning);
+	}
+
+	bool InputReplay::IsPlaying() const
+	{
+		return (Mode == ReplayMode::Playback && IsRunning);
+	}
+
+	bool InputReplay::ArmRecording(const std::string& path, unsigned int hashInterval)
+	{
+		if (Mode != ReplayMode::None)
+			return false;
+
+		Mode = ReplayMode::Record;
+		Path = path;
+		HashInterval = std::max(hashInterval, 1u);
+
+		TENLog("Input recording armed. Recording will start with next level.", LogLevel::Info);
+		return true;
+	}
+
+	bool InputReplay::ArmPlayback(const std::string& path)
+	{
+		if (Mode != ReplayMode::None)
+			return false;
+
+		Path = path;
+		if (!ReadFile())
+			return false;
+
+		Mode = ReplayMode::Playback;
+		TENLog("Replay of level " + std::to_string(LevelIndex) + " armed (" + std::to_string(TickCount) + " ticks).", LogLevel::Info);
+		return true;
+	}
+
+	void InputReplay::BeginLevel(int levelIndex, bool isLoadedGame)
+	{
+		if (Mode == ReplayMode::None || IsRunning || levelIndex == 0)
+			return;
+
+		// Savegame state isn't part of replay, so only fresh level starts are reproducible.
+		if (isLoadedGame)
+		{
+			TENLog("Replays can't start from a savegame. Start level anew to use replay.", LogLevel::Warning);
+			return;
+		}
+
+		if (Mode == ReplayMode::Record)
+		{
+			Seed = std::random_device{}();
+			LevelIndex = levelIndex;
+			std::memcpy(Layout.data(), KeyboardLayout, sizeof(KeyboardLayout));
+			Data.clear();
+		}
+		else
+		{
+			if (levelIndex != LevelIndex)
+			{
+				TENLog("Replay was recorded in level " + std::to_string(LevelIndex) + ", not starting it in level " + std::to_string(levelIndex) + ".", LogLevel::Warning);
+				return;
+			}
+
+			// Recorded raw input is only meaningful with recorded key bindings.
+			std::memcpy(SavedLayout.data(), KeyboardLayout, sizeof(KeyboardLayout));
+			std::memcpy(KeyboardLayout, Layout.data(), sizeof(KeyboardLayout));
+			DataPosition = 0;
+		}
+
+		// Seed before level is loaded, so that item initialisation is reproduced as well.
+		Random::SetSeed(Seed);
+
+		Tick = 0;
+		TickFlags = 0;
+		Keys.clear();
+		PrevKeys.clear();
+		Axes.fill(0.0f);
+		PrevAxes.fill(0.0f);
+		MismatchCount = 0;
+		FirstMismatchTick = -1;
+		LogicTime = 0.0;
+		StartTime = std::chrono::steady_clock::now();
+		IsRunning = true;
+
+		TENLog(std::string(Mode == ReplayMode::Record ? "Recording" : "Replaying") + " level " + std::to_string(LevelIndex) +
+			   " with seed " + std::to_string(Seed) + ".", LogLevel::Info);
+	}
+
+	void InputReplay::EndLevel()
+	{
+		if (!IsRunning)
+			return;
+
+		if (Mode == ReplayMode::Record)
+		{
+			TickCount = Tick;
+			if (WriteFile())
+				TENLog("Recorded " + std::to_string(TickCount) + " ticks (" + std::to_string(Data.size()) + " bytes) to " + Path + ".", LogLevel::Info);
+		}
+		else
+		{
+			TENLog("Level ended before replay finished.", LogLevel::Warning);
+			LogSummary();
+		}
+
+		Stop();
+	}
+
+	void InputReplay::BeginTick()
+	{
+		if (!IsRunning)
+			return;
+
+		TickStartTime = std::chrono::steady_clock::now();
+
+		if (Mode == ReplayMode::Playback)
+			ReadTick();
+	}
+
+	void InputReplay::ProcessInput(std::vector<bool>& keyMap, std::vector<float>& axisMap)
+	{
+		if (!IsRunning)
+			return;
+
+		if (Mode == ReplayMode::Record)
+		{
+			Keys.clear();
+			for (int i = 0; i < keyMap.size(); i++)
+			{
+				if (keyMap[i])
+					Keys.push_back((unsigned short)i);
+			}
+
+			for (int i = 0; i < Axes.size(); i++)
+				Axes[i] = axisMap[i];
+		}
+		else
+		{
+			std::fill(keyMap.begin(), keyMap.end(), false);
+			for (auto key : Keys)
+			{
+				if (key < keyMap.size())
+					keyMap[key] = true;
+			}
+
+			for (int i = 0; i < Axes.size(); i++)
+				axisMap[i] = Axes[i];
+		}
+	}
+
+	void InputReplay::EndTick()
+	{
+		if (!IsRunning)
+			return;
+
+		if (Mode == ReplayMode::Record)
+		{
+			WriteTick();
+		}
+		else if (TickFlags & TICK_STATE_HASH)
+		{
+			auto stateHash = ComputeStateHash();
+			if (stateHash != StateHash)
+			{
+				if (MismatchCount == 0)
+				{
+					FirstMismatchTick = Tick;
+					TENLog("Replay diverged from recording at tick " + std::to_string(Tick) + ".", LogLevel::Warning);
+				}
+
+				MismatchCount++;
+			}
+		}
+
+		auto endTime = std::chrono::steady_clock::now();
+		LogicTime += std::chrono::duration_cast<std::chrono::microseconds>(endTime - TickStartTime).count() / 1000.0;
+		Tick++;
+
+		// Hand control back to player once recorded input runs out.
+		if (Mode == ReplayMode::Playback && Tick >= TickCount)
+		{
+			LogSummary();
+			Stop();
+		}
+	}
+
+	void InputReplay::Stop()
+	{
+		if (Mode == ReplayMode::Playback && IsRunning)
+			std::memcpy(KeyboardLayout, SavedLayout.data(), sizeof(KeyboardLayout));
+
+		Mode = ReplayMode::None;
+		IsRunning = false;
+		Data.clear();
+		Data.shrink_to_fit();
+	}
+
+	void InputReplay::LogSummary() const
+	{
+		double wallTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - StartTime).count() / 1000.0;
+		double tickTime = (Tick != 0) ? (LogicTime / Tick) : 0.0;
+
+		auto summary = "Replay finished: " + std::to_string(Tick) + " ticks in " + std::to_string(wallTime) + " s, " +
+					   std::to_string(tickTime) + " ms logic time per tick, " + std::to_string(MismatchCount) + " state mismatches";
+		if (MismatchCount != 0)
+			summary += " (first at tick " + std::to_string(FirstMismatchTick) + ")";
+
+		TENLog(summary + ".", (MismatchCount != 0) ? LogLevel::Warning : LogLevel::Info);
+	}
+
+	// Tick record: flags byte, then optionally delta-coded list of pressed input slots,
+	// raw axis values and state hash. Unchanged input costs a single byte per tick.
+	void InputReplay::WriteTick()
+	{
+		int flags = 0;
+		if (Keys != PrevKeys)
+			flags |= TICK_KEYS_CHANGED;
+
+		if (Axes != PrevAxes)
+			flags |= TICK_AXES_CHANGED;
+
+		if ((Tick % HashInterval) == 0)
+			flags |= TICK_STATE_HASH;
+
+		Data.push_back((unsigned char)flags);
+
+		if (flags & TICK_KEYS_CHANGED)
+		{
+			WriteVarUInt(Keys.size());
+
+			unsigned short prevKey = 0;
+			for (auto key : Keys)
+			{
+				WriteVarUInt(key - prevKey);
+				prevKey = key;
+			}
+
+			PrevKeys = Keys;
+		}
+
+		if (flags & TICK_AXES_CHANGED)
+		{
+			WriteRaw(Axes.data(), sizeof(float) * (unsigned int)Axes.size());
+			PrevAxes = Axes;
+		}
+
+		if (flags & TICK_STATE_HASH)
+		{
+			auto stateHash = ComputeStateHash();
+			WriteRaw(&stateHash, sizeof(stateHash));
+		}
+	}
+
+	void InputReplay::ReadTick()
+	{
+		TickFlags = 0;
+		if (DataPosition >= Data.size())
+			return;
+
+		TickFlags = Data[DataPosition++];
+
+		if (TickFlags & TICK_KEYS_CHANGED)
+		{
+			Keys.resize(ReadVarUInt());
+
+			unsigned short prevKey = 0;
+			for (auto& key : Keys)
+			{
+				key = prevKey + (unsigned short)ReadVarUInt();
+				prevKey = key;
+			}
+		}
+
+		if (TickFlags & TICK_AXES_CHANGED)
+			ReadRaw(Axes.data(), sizeof(float) * (unsigned int)Axes.size());
+
+		if (TickFlags & TICK_STATE_HASH)
+			ReadRaw(&StateHash, sizeof(StateHash));
+	}
+
+	bool InputReplay::ReadFile()
+	{
+		auto file = std::ifstream(Path, std::ios::in | std::ios::binary);
+		if (!file.is_open())
+		{
+			TENLog("Could not open replay file " + Path + ".", LogLevel::Error);
+			return false;
+		}
+
+		Data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		DataPosition = 0;
+
+		unsigned int magic = 0;
+		unsigned int version = 0;
+		unsigned int dataSize = 0;
+		if (!ReadRaw(&magic, sizeof(magic)) || !ReadRaw(&version, sizeof(version)) ||
+			magic != FILE_MAGIC || version != FILE_VERSION)
+		{
+			TENLog("Replay file " + Path + " is not a valid replay or was recorded with another version.", LogLevel::Error);
+			Data.clear();
+			return false;
+		}
+
+		ReadRaw(&LevelIndex, sizeof(LevelIndex));
+		ReadRaw(&Seed, sizeof(Seed));
+		ReadRaw(&HashInterval, sizeof(HashInterval));
+		ReadRaw(&TickCount, sizeof(TickCount));
+		ReadRaw(Layout.data(), sizeof(short) * (unsigned int)Layout.size());
+		if (!ReadRaw(&dataSize, sizeof(dataSize)) || (DataPosition + dataSize) != Data.size())
+		{
+			TENLog("Replay file " + Path + " is truncated.", LogLevel::Error);
+			Data.clear();
+			return false;
+		}
+
+		// Keep tick records only.
+		Data.erase(Data.begin(), Data.begin() + DataPosition);
+		DataPosition = 0;
+		return true;
+	}
+
+	bool InputReplay::WriteFile() const
+	{
+		auto file = std::ofstream(Path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			TENLog("Could not write replay file " + Path + ".", LogLevel::Error);
+			return false;
+		}
+
+		unsigned int magic = FILE_MAGIC;
+		unsigned int version = FILE_VERSION;
+		unsigned int dataSize = (unsigned int)Data.size();
+
+		file.write((const char*)&magic, sizeof(magic));
+		file.write((const char*)&version, sizeof(version));
+		file.write((const char*)&LevelIndex, sizeof(LevelIndex));
+		file.write((const char*)&Seed, sizeof(Seed));
+		file.write((const char*)&HashInterval, sizeof(HashInterval));
+		file.write((const char*)&TickCount, sizeof(TickCount));
+		file.write((const char*)Layout.data(), sizeof(short) * Layout.size());
+		file.write((const char*)&dataSize, sizeof(dataSize));
+		file.write((const char*)Data.data(), Data.size());
+		return file.good();
+	}
+
+	void InputReplay::WriteVarUInt(unsigned long long value)
+	{
+		do
+		{
+			auto byte = (unsigned char)(value & 0x7F);
+			value >>= 7;
+
+			if (value != 0)
+				byte |= 0x80;
+
+			Data.push_back(byte);
+		} while (value != 0);
+	}
+
+	unsigned int InputReplay::ReadVarUInt()
+	{
+		unsigned int value = 0;
+		int shift = 0;
+
+		while (DataPosition < Data.size() && shift < 32)
+		{
+			auto byte = Data[DataPosition++];
+			value |= (unsigned int)(byte & 0x7F) << shift;
+			shift += 7;
+
+			if (!(byte & 0x80))
+				break;
+		}
+
+		return value;
+	}
+
+	void InputReplay::WriteRaw(const void* src, unsigned int size)
+	{
+		auto* bytes = (const unsigned char*)src;
+		Data.insert(Data.end(), bytes, bytes + size);
+	}
+
+	bool InputReplay::ReadRaw(void* dest, unsigned int size)
+	{
+		if ((DataPosition + size) > Data.size())
+		{
+			std::memset(dest, 0, size);
+			DataPosition = (unsigned int)Data.size();
+			return false;
+		}
+
+		std::memcpy(dest, &Data[DataPosition], size);
+		DataPosition += size;
+		return true;
+	}
+
+	// FNV-1a over gameplay-relevant state of all items and active effects.
+	unsigned long long ComputeStateHash()
+	{
+		constexpr auto FNV_OFFSET_BASIS = 14695981039346656037ull;
+		constexpr auto FNV_PRIME		= 1099511628211ull;
+
+		auto hash = FNV_OFFSET_BASIS;
+		auto hashValue = [&hash](auto value)
+		{
+			const auto* bytes = (const unsigned char*)&value;
+			for (int i = 0; i < sizeof(value); i++)
+				hash = (hash ^ bytes[i]) * FNV_PRIME;
+		};
+
+		hashValue(GameTimer);
+
+		for (const auto& item : g_Level.Items)
+		{
+			hashValue(item.Pose.Position.x);
+			hashValue(item.Pose.Position.y);
+			hashValue(item.Pose.Position.z);
+			hashValue(item.Pose.Orientation.x);
+			hashValue(item.Pose.Orientation.y);
+			hashValue(item.Pose.Orientation.z);
+			hashValue(item.RoomNumber);
+			hashValue(item.Animation.AnimNumber);
+			hashValue(item.Animation.FrameNumber);
+			hashValue(item.Animation.ActiveState);
+			hashValue(item.HitPoints);
+			hashValue(item.Status);
+			hashValue(item.Flags);
+		}
+
+		for (short fxNumber = NextFxActive; fxNumber != NO_ITEM; fxNumber = EffectList[fxNumber].nextActive)
+		{
+			const auto& fx = EffectList[fxNumber];
+			hashValue(fx.pos.Position.x);
+			hashValue(fx.pos.Position.y);
+			hashValue(fx.pos.Position.z);
+			hashValue(fx.objectNumber);
+		}
+
+		return hash;
+	}
+}
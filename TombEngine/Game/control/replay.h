@@ -0,0 +1,100 @@
+#pragma once
+#include <chrono>
+
+#include "Specific/Input/Input.h"
+
+// Deterministic input recording and replay.
+// Raw input of every gameplay tick is captured together with RNG seed set at level start, so a level
+// session can be replayed exactly. Game state hashes are stored periodically and compared on playback,
+// so any change in game behaviour is reported with the tick at which it first occurred.
+
+namespace TEN::Control::Replay
+{
+	enum class ReplayMode
+	{
+		None,
+		Record,
+		Playback
+	};
+
+	class InputReplay
+	{
+	private:
+		// Constants
+		static constexpr auto FILE_MAGIC			= 0x524E4554; // "TENR"
+		static constexpr auto FILE_VERSION			= 1;
+		static constexpr auto HASH_INTERVAL_DEFAULT = 30; // In ticks.
+
+		enum TickRecordFlags
+		{
+			TICK_KEYS_CHANGED = (1 << 0),
+			TICK_AXES_CHANGED = (1 << 1),
+			TICK_STATE_HASH	  = (1 << 2)
+		};
+
+		// Members
+		ReplayMode	 Mode		  = ReplayMode::None;
+		bool		 IsRunning	  = false; // Mode is armed until level start.
+		std::string	 Path		  = {};
+		int			 LevelIndex	  = 0;
+		unsigned int Seed		  = 0;
+		unsigned int HashInterval = HASH_INTERVAL_DEFAULT;
+		unsigned int Tick		  = 0;
+		unsigned int TickCount	  = 0;
+		int			 TickFlags	  = 0; // Flags of current tick record.
+
+		std::vector<unsigned char> Data			= {};
+		unsigned int			   DataPosition = 0;
+
+		std::vector<unsigned short>						Keys		= {}; // Sorted pressed input slots.
+		std::vector<unsigned short>						PrevKeys	= {};
+		std::array<float, TEN::Input::InputAxis::Count> Axes		= {};
+		std::array<float, TEN::Input::InputAxis::Count> PrevAxes	= {};
+		std::array<short, TEN::Input::KEY_COUNT * 2>	Layout		= {}; // Keyboard layout used for recording.
+		std::array<short, TEN::Input::KEY_COUNT * 2>	SavedLayout = {}; // Player's own layout, restored after playback.
+		unsigned long long								StateHash	= 0;
+
+		unsigned int MismatchCount	   = 0;
+		int			 FirstMismatchTick = -1;
+
+		std::chrono::steady_clock::time_point StartTime		= {};
+		std::chrono::steady_clock::time_point TickStartTime = {};
+		double								  LogicTime		= 0.0; // In milliseconds.
+
+	public:
+		// Getters
+		ReplayMode	 GetMode() const;
+		unsigned int GetTick() const;
+
+		// Inquirers
+		bool IsRecording() const;
+		bool IsPlaying() const;
+
+		// Utilities
+		bool ArmRecording(const std::string& path, unsigned int hashInterval = HASH_INTERVAL_DEFAULT);
+		bool ArmPlayback(const std::string& path);
+		void BeginLevel(int levelIndex, bool isLoadedGame);
+		void EndLevel();
+		void BeginTick();
+		void ProcessInput(std::vector<bool>& keyMap, std::vector<float>& axisMap);
+		void EndTick();
+
+	private:
+		// Helpers
+		void Stop();
+		void LogSummary() const;
+		void ReadTick();
+		void WriteTick();
+		bool ReadFile();
+		bool WriteFile() const;
+
+		void		 WriteVarUInt(unsigned long long value);
+		unsigned int ReadVarUInt();
+		void		 WriteRaw(const void* src, unsigned int size);
+		bool		 ReadRaw(void* dest, unsigned int size);
+	};
+
+	extern InputReplay g_InputReplay;
+
+	unsigned long long ComputeStateHash();
+}
@@ -0,0 +1,194 @@
+#include "framework.h"
+#include "Game/control/scheduler.h"
+
+#include "Game/camera.h"
+#include "Game/items.h"
+#include "Game/itemdata/creature_info.h"
+#include "Game/Lara/lara.h"
+#include "Game/misc.h"
+#include "Specific/level.h"
+#include "Specific/setup.h"
+
+namespace TEN::Control::Scheduler
+{
+	ItemScheduler g_ItemScheduler = {};
+
+	unsigned int ItemScheduler::GetTickInterval(TickPriority priority)
+	{
+		switch (priority)
+		{
+		default:
+		case TickPriority::High:
+			return 1;
+
+		case TickPriority::Medium:
+			return 2;
+
+		case TickPriority::Low:
+			return 4;
+
+		case TickPriority::Sleep:
+			return 0;
+		}
+	}
+
+	TickPriority ItemScheduler::GetPriority(int itemNumber) const
+	{
+		if (itemNumber < 0 || itemNumber >= ItemStates.size())
+			return TickPriority::High;
+
+		return ItemStates[itemNumber].Priority;
+	}
+
+	const std::vector<int>& ItemScheduler::GetBucket(TickPriority priority) const
+	{
+		return Buckets[(int)priority];
+	}
+
+	unsigned int ItemScheduler::GetTickCount() const
+	{
+		return TickCount;
+	}
+
+	unsigned int ItemScheduler::GetSkipCount() const
+	{
+		return SkipCount;
+	}
+
+	void ItemScheduler::Clear()
+	{
+		Frame = 0;
+		IsEnabled = false;
+		ItemStates.clear();
+		IsRoomNear.clear();
+
+		for (auto& bucket : Buckets)
+			bucket.clear();
+
+		TickCount = 0;
+		SkipCount = 0;
+	}
+
+	void ItemScheduler::BeginFrame()
+	{
+		Frame++;
+
+		TickCount = 0;
+		SkipCount = 0;
+
+		// Object policies are fixed once level is loaded, so test them only when item states are reallocated.
+		if (ItemStates.size() != g_Level.Items.size())
+		{
+			ItemStates.resize(g_Level.Items.size());
+			IsEnabled = TestThrottledObjects();
+		}
+
+		if (!IsEnabled)
+			return;
+
+		for (auto& bucket : Buckets)
+			bucket.clear();
+
+		// Rooms up to two portals away from player or camera are treated as visible.
+		IsRoomNear.assign(g_Level.Rooms.size(), false);
+		int playerRoomNumber = (LaraItem != nullptr) ? LaraItem->RoomNumber : NO_ROOM;
+		for (int roomNumber : { playerRoomNumber, (int)Camera.pos.RoomNumber })
+		{
+			if (roomNumber < 0 || roomNumber >= g_Level.Rooms.size())
+				continue;
+
+			IsRoomNear[roomNumber] = true;
+			for (int neighborRoomNumber : g_Level.Rooms[roomNumber].neighbors)
+				IsRoomNear[neighborRoomNumber] = true;
+		}
+	}
+
+	bool ItemScheduler::TestTick(int itemNumber)
+	{
+		if (!IsEnabled)
+		{
+			TickCount++;
+			return true;
+		}
+
+		auto& item = g_Level.Items[itemNumber];
+		auto& state = ItemStates[itemNumber];
+
+		state.Priority = CalculatePriority(item, state);
+		Buckets[(int)state.Priority].push_back(itemNumber);
+
+		if (state.WakeFrameCount > 0)
+			state.WakeFrameCount--;
+
+		unsigned int interval = GetTickInterval(state.Priority);
+		if (interval == 0 || (Frame - state.LastTickFrame) < interval)
+		{
+			SkipCount++;
+			return false;
+		}
+
+		state.LastTickFrame = Frame;
+		TickCount++;
+		return true;
+	}
+
+	void ItemScheduler::Wake(int itemNumber)
+	{
+		if (itemNumber < 0 || itemNumber >= ItemStates.size())
+			return;
+
+		auto& state = ItemStates[itemNumber];
+		state.Priority = TickPriority::High;
+		state.LastTickFrame = 0;
+		state.WakeFrameCount = WAKE_FRAME_COUNT;
+	}
+
+	bool ItemScheduler::TestThrottledObjects()
+	{
+		for (int objectNumber = 0; objectNumber < ID_NUMBER_OBJECTS; objectNumber++)
+		{
+			auto policy = Objects[objectNumber].tickPolicy;
+			if (policy != TickPolicy::Default && policy != TickPolicy::EveryFrame)
+				return true;
+		}
+
+		return false;
+	}
+
+	TickPriority ItemScheduler::CalculatePriority(ItemInfo& item, ItemTickState& state) const
+	{
+		auto policy = Objects[item.ObjectNumber].tickPolicy;
+
+		// Dying items, recently woken items and anything the player is involved with are always updated.
+		if (policy == TickPolicy::Default || policy == TickPolicy::EveryFrame ||
+			item.AfterDeath > 0 || state.WakeFrameCount > 0 ||
+			&item == LaraItem || item.Index == Lara.Vehicle || item.Index == Lara.InteractedItem ||
+			IsRoomNear.empty() || IsRoomNear[item.RoomNumber])
+		{
+			return TickPriority::High;
+		}
+
+		if (policy == TickPolicy::SleepUntilVisible)
+			return TickPriority::Sleep;
+
+		// Creatures which are already engaged keep full update rate.
+		if (item.IsCreature())
+		{
+			const auto& creature = *GetCreatureInfo(&item);
+			if (creature.Alerted || creature.HurtByLara)
+				return TickPriority::High;
+		}
+
+		float distance = Vector3i::Distance(item.Pose.Position, Camera.pos.ToVector3i());
+		if (LaraItem != nullptr)
+			distance = std::min(distance, Vector3i::Distance(item.Pose.Position, LaraItem->Pose.Position));
+
+		if (distance <= HIGH_PRIORITY_RANGE)
+			return TickPriority::High;
+
+		if (distance <= MEDIUM_PRIORITY_RANGE)
+			return TickPriority::Medium;
+
+		return TickPriority::Low;
+	}
+}
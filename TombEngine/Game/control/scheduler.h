@@ -0,0 +1,72 @@
+#pragma once
+#include "Math/Math.h"
+
+struct ItemInfo;
+
+// Active item scheduling.
+// Every active item is assigned a tick priority each frame according to its object's TickPolicy.
+// Items of lower priority are updated only every few frames, sleeping items are not updated at all.
+// Skipped ticks are not caught up, so only objects which opt in to reduced rates are ever throttled.
+// While no object in the level opts in, scheduling is bypassed and no per-frame bookkeeping is done.
+// Update order of active items is left untouched, as it affects gameplay.
+
+namespace TEN::Control::Scheduler
+{
+	enum class TickPriority
+	{
+		High,	// Every frame.
+		Medium, // Every 2nd frame.
+		Low,	// Every 4th frame.
+		Sleep,	// Not updated.
+
+		Count
+	};
+
+	class ItemScheduler
+	{
+	private:
+		// Constants
+		static constexpr auto HIGH_PRIORITY_RANGE	= BLOCK(8);
+		static constexpr auto MEDIUM_PRIORITY_RANGE = BLOCK(16);
+		static constexpr auto WAKE_FRAME_COUNT		= 30; // Frames woken item is updated before it may sleep again.
+
+		struct ItemTickState
+		{
+			TickPriority Priority		= TickPriority::High;
+			unsigned int LastTickFrame	= 0;
+			unsigned int WakeFrameCount = 0;
+		};
+
+		// Members
+		unsigned int			   Frame		   = 0;
+		bool					   IsEnabled	   = false; // Set if any object in level uses reduced tick policy.
+		std::vector<ItemTickState> ItemStates	   = {};
+		std::vector<bool>		   IsRoomNear	   = {}; // Rooms near player or camera count as visible.
+
+		std::array<std::vector<int>, (int)TickPriority::Count> Buckets = {};
+		unsigned int TickCount = 0;
+		unsigned int SkipCount = 0;
+
+	public:
+		// Getters
+		static unsigned int GetTickInterval(TickPriority priority);
+
+		TickPriority			GetPriority(int itemNumber) const;
+		const std::vector<int>& GetBucket(TickPriority priority) const;
+		unsigned int			GetTickCount() const;
+		unsigned int			GetSkipCount() const;
+
+		// Utilities
+		void Clear();
+		void BeginFrame();
+		bool TestTick(int itemNumber);
+		void Wake(int itemNumber);
+
+	private:
+		// Helpers
+		static bool	 TestThrottledObjects();
+		TickPriority CalculatePriority(ItemInfo& item, ItemTickState& state) const;
+	};
+
+	extern ItemScheduler g_ItemScheduler;
+}
@@ -0,0 +1,299 @@
+#include "framework.h"
+#include "Game/control/snapshot.h"
+
+#include <chrono>
+
+#include "Game/control/control.h"
+#include "Game/effects/effects.h"
+#include "Game/items.h"
+#include "Game/Lara/lara.h"
+#include "Specific/level.h"
+#include "Specific/setup.h"
+
+namespace TEN::Control::Snapshot
+{
+	RenderSnapshotBuffer RenderSnapshots = {};
+
+	static auto PendingCamera = CameraSnapshot{};
+
+	bool RenderSnapshot::HasItem(int itemNumber) const
+	{
+		if (itemNumber < 0 || itemNumber >= Items.size())
+			return false;
+
+		return (Items[itemNumber].Tick == Tick);
+	}
+
+	bool RenderSnapshot::HasEffect(int fxNumber) const
+	{
+		if (fxNumber < 0 || fxNumber >= Effects.size())
+			return false;
+
+		return (Effects[fxNumber].Tick == Tick);
+	}
+
+	RenderSnapshot& RenderSnapshotBuffer::GetCurrent()
+	{
+		return Snapshots[CurrentIndex];
+	}
+
+	RenderSnapshot& RenderSnapshotBuffer::GetPrevious()
+	{
+		return Snapshots[CurrentIndex ^ 1];
+	}
+
+	const RenderSnapshot& RenderSnapshotBuffer::GetCurrent() const
+	{
+		return Snapshots[CurrentIndex];
+	}
+
+	const RenderSnapshot& RenderSnapshotBuffer::GetPrevious() const
+	{
+		return Snapshots[CurrentIndex ^ 1];
+	}
+
+	float RenderSnapshotBuffer::GetBuildTime() const
+	{
+		return BuildTime;
+	}
+
+	unsigned int RenderSnapshotBuffer::GetCapturedItemCount() const
+	{
+		return CapturedItems;
+	}
+
+	float RenderSnapshotBuffer::GetAlpha(double time) const
+	{
+		if (!CanInterpolate())
+			return 1.0f;
+
+		// Display lags one logic tick behind, so current snapshot is reached exactly at its logic time.
+		double alpha = 1.0 - ((GetCurrent().LogicTime - time) / TICK_LENGTH);
+		return (float)std::clamp(alpha, 0.0, 1.0);
+	}
+
+	bool RenderSnapshotBuffer::CanInterpolate() const
+	{
+		return (TickCount >= 2 && (GetCurrent().Tick - GetPrevious().Tick) == 1);
+	}
+
+	RenderSnapshot& RenderSnapshotBuffer::BeginSnapshot(double logicTime)
+	{
+		// Overwrite older snapshot. Item and effect arrays keep their capacity between ticks.
+		unsigned int tick = GetCurrent().Tick + 1;
+		CurrentIndex ^= 1;
+		TickCount++;
+
+		auto& snapshot = GetCurrent();
+		snapshot.Tick = tick;
+		snapshot.LogicTime = logicTime;
+		return snapshot;
+	}
+
+	void RenderSnapshotBuffer::EndSnapshot(float buildTime, unsigned int capturedItemCount)
+	{
+		BuildTime = buildTime;
+		CapturedItems = capturedItemCount;
+	}
+
+	void RenderSnapshotBuffer::Clear()
+	{
+		for (auto& snapshot : Snapshots)
+		{
+			snapshot.Items.clear();
+			snapshot.Effects.clear();
+		}
+
+		// Keep tick counter running so stale entries never match a new snapshot.
+		TickCount = 0;
+		BuildTime = 0.0f;
+		CapturedItems = 0;
+	}
+
+	CameraSnapshot RenderSnapshotBuffer::GetInterpolatedCamera(float alpha) const
+	{
+		if (!CanInterpolate())
+			return GetCurrent().Camera;
+
+		return InterpolateCamera(GetPrevious().Camera, GetCurrent().Camera, alpha);
+	}
+
+	bool RenderSnapshotBuffer::GetInterpolatedItemPose(int itemNumber, float alpha, Vector3& outPos, Quaternion& outOrient) const
+	{
+		const auto& current = GetCurrent();
+		const auto& prev = GetPrevious();
+
+		if (!CanInterpolate() || !current.HasItem(itemNumber) || !prev.HasItem(itemNumber))
+			return false;
+
+		const auto& itemSnapshot = current.Items[itemNumber];
+		const auto& prevItemSnapshot = prev.Items[itemNumber];
+
+		InterpolatePose(
+			prevItemSnapshot.Position, prevItemSnapshot.Orientation,
+			itemSnapshot.Position, itemSnapshot.Orientation,
+			alpha, outPos, outOrient);
+		return true;
+	}
+
+	bool RenderSnapshotBuffer::GetInterpolatedEffectPose(int fxNumber, float alpha, Vector3& outPos, Quaternion& outOrient) const
+	{
+		const auto& current = GetCurrent();
+		const auto& prev = GetPrevious();
+
+		if (!CanInterpolate() || !current.HasEffect(fxNumber) || !prev.HasEffect(fxNumber))
+			return false;
+
+		const auto& fxSnapshot = current.Effects[fxNumber];
+		const auto& prevFxSnapshot = prev.Effects[fxNumber];
+
+		// Effect slot was reused by another object.
+		if (fxSnapshot.ObjectID != prevFxSnapshot.ObjectID)
+			return false;
+
+		InterpolatePose(
+			prevFxSnapshot.Position, prevFxSnapshot.Orientation,
+			fxSnapshot.Position, fxSnapshot.Orientation,
+			alpha, outPos, outOrient);
+		return true;
+	}
+
+	AnimFrameInterpData RenderSnapshotBuffer::GetInterpolatedFrameData(int itemNumber, float alpha)
+	{
+		auto& current = GetCurrent();
+		auto& prev = GetPrevious();
+
+		if (!CanInterpolate() || !current.HasItem(itemNumber) || !prev.HasItem(itemNumber))
+			return AnimFrameInterpData{};
+
+		auto& frame = current.Items[itemNumber].Frame;
+		auto& prevFrame = prev.Items[itemNumber].Frame;
+
+		if (frame.BoneOrientations.empty() || frame.BoneOrientations.size() != prevFrame.BoneOrientations.size())
+			return AnimFrameInterpData{};
+
+		return AnimFrameInterpData{ &prevFrame, &frame, alpha };
+	}
+
+	CameraSnapshot InterpolateCamera(const CameraSnapshot& prev, const CameraSnapshot& current, float alpha)
+	{
+		// Don't interpolate through camera cuts.
+		if (Vector3::Distance(prev.Position, current.Position) > SNAPSHOT_TELEPORT_DISTANCE)
+			return current;
+
+		auto camera = current;
+		camera.Position = Vector3::Lerp(prev.Position, current.Position, alpha);
+		camera.Target = Vector3::Lerp(prev.Target, current.Target, alpha);
+		camera.Roll = Lerp(prev.Roll, current.Roll, alpha);
+		camera.Fov = Lerp(prev.Fov, current.Fov, alpha);
+		return camera;
+	}
+
+	void InterpolatePose(const Vector3& prevPos, const Quaternion& prevOrient, const Vector3& pos, const Quaternion& orient,
+						 float alpha, Vector3& outPos, Quaternion& outOrient)
+	{
+		if (Vector3::Distance(prevPos, pos) > SNAPSHOT_TELEPORT_DISTANCE)
+		{
+			outPos = pos;
+			outOrient = orient;
+			return;
+		}
+
+		outPos = Vector3::Lerp(prevPos, pos, alpha);
+		outOrient = Quaternion::Slerp(prevOrient, orient, alpha);
+	}
+
+	void BlendFrame(const AnimFrame& frame0, const AnimFrame& frame1, float alpha, AnimFrame& outFrame)
+	{
+		// Resize only, so that capacity is reused between ticks.
+		outFrame.BoneOrientations.resize(frame0.BoneOrientations.size());
+		outFrame.BoundingBox = frame0.BoundingBox;
+
+		if (alpha <= 0.0f || frame1.BoneOrientations.size() != frame0.BoneOrientations.size())
+		{
+			outFrame.Offset = frame0.Offset;
+			std::copy(frame0.BoneOrientations.begin(), frame0.BoneOrientations.end(), outFrame.BoneOrientations.begin());
+			return;
+		}
+
+		outFrame.Offset = Vector3::Lerp(frame0.Offset, frame1.Offset, alpha);
+		SlerpArray(
+			frame0.BoneOrientations.data(), frame1.BoneOrientations.data(), alpha,
+			(int)frame0.BoneOrientations.size(), outFrame.BoneOrientations.data());
+	}
+
+	void RegisterCameraSnapshot(const Vector3& pos, const Vector3& target, int roomNumber, float roll, float fov, float farView)
+	{
+		PendingCamera.Position = pos;
+		PendingCamera.Target = target;
+		PendingCamera.RoomNumber = roomNumber;
+		PendingCamera.Roll = roll;
+		PendingCamera.Fov = fov;
+		PendingCamera.FarView = farView;
+	}
+
+	void CaptureItemSnapshot(const ItemInfo& item, ItemSnapshot& snapshot, unsigned int tick)
+	{
+		snapshot.Tick = tick;
+		snapshot.Position = item.Pose.Position.ToVector3();
+		snapshot.Orientation = item.Pose.Orientation.ToQuaternion();
+		snapshot.RoomNumber = item.RoomNumber;
+
+		if (Objects[item.ObjectNumber].animIndex == NO_ANIM)
+		{
+			snapshot.AnimNumber = NO_ANIM;
+			snapshot.Frame.BoneOrientations.clear();
+			return;
+		}
+
+		auto frameData = GetFrameInterpData(item);
+		snapshot.AnimNumber = item.Animation.AnimNumber;
+		BlendFrame(*frameData.FramePtr0, *frameData.FramePtr1, frameData.Alpha, snapshot.Frame);
+	}
+
+	void CaptureRenderSnapshot(double logicTime)
+	{
+		auto startTime = std::chrono::high_resolution_clock::now();
+
+		auto& snapshot = RenderSnapshots.BeginSnapshot(logicTime);
+		snapshot.Camera = PendingCamera;
+
+		if (snapshot.Items.size() != g_Level.Items.size())
+			snapshot.Items.resize(g_Level.Items.size());
+
+		if (snapshot.Effects.size() != NUM_EFFECTS)
+			snapshot.Effects.resize(NUM_EFFECTS);
+
+		// Only active items can change pose. Inactive ones are drawn from live state.
+		unsigned int itemCount = 0;
+		if (LaraItem != nullptr && LaraItem->Index >= 0 && LaraItem->Index < snapshot.Items.size())
+		{
+			CaptureItemSnapshot(*LaraItem, snapshot.Items[LaraItem->Index], snapshot.Tick);
+			itemCount++;
+		}
+
+		for (short itemNumber = NextItemActive; itemNumber != NO_ITEM; itemNumber = g_Level.Items[itemNumber].NextActive)
+		{
+			if (snapshot.HasItem(itemNumber))
+				continue;
+
+			CaptureItemSnapshot(g_Level.Items[itemNumber], snapshot.Items[itemNumber], snapshot.Tick);
+			itemCount++;
+		}
+
+		for (short fxNumber = NextFxActive; fxNumber != NO_ITEM; fxNumber = EffectList[fxNumber].nextActive)
+		{
+			const auto& fx = EffectList[fxNumber];
+			auto& fxSnapshot = snapshot.Effects[fxNumber];
+
+			fxSnapshot.Tick = snapshot.Tick;
+			fxSnapshot.Position = fx.pos.Position.ToVector3();
+			fxSnapshot.Orientation = fx.pos.Orientation.ToQuaternion();
+			fxSnapshot.ObjectID = fx.objectNumber;
+		}
+
+		auto endTime = std::chrono::high_resolution_clock::now();
+		float buildTime = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count() / 1000.0f;
+		RenderSnapshots.EndSnapshot(buildTime, itemCount);
+	}
+}
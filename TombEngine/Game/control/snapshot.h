@@ -0,0 +1,108 @@
+#pragma once
+#include "Game/animation.h"
+#include "Math/Math.h"
+
+struct ItemInfo;
+
+// Render snapshots hold presentation state captured at the end of each logic tick.
+// Renderer interpolates between the last two snapshots, so display rate is decoupled from 30 Hz logic rate.
+// Everything except CaptureRenderSnapshot() is independent of level and renderer data.
+
+namespace TEN::Control::Snapshot
+{
+	constexpr auto SNAPSHOT_TELEPORT_DISTANCE = BLOCK(2); // Position change above which interpolation snaps.
+
+	struct CameraSnapshot
+	{
+		Vector3 Position   = Vector3::Zero;
+		Vector3 Target	   = Vector3::Zero;
+		int		RoomNumber = 0;
+		float	Roll	   = 0.0f;
+		float	Fov		   = 0.0f;
+		float	FarView	   = 0.0f;
+	};
+
+	struct ItemSnapshot
+	{
+		unsigned int Tick = 0; // Valid only if equal to owning snapshot's tick.
+
+		Vector3	   Position	   = Vector3::Zero;
+		Quaternion Orientation = Quaternion::Identity;
+		int		   RoomNumber  = 0;
+		int		   AnimNumber  = NO_ANIM;
+		AnimFrame  Frame	   = {}; // Keyframes blended at captured frame number.
+	};
+
+	struct EffectSnapshot
+	{
+		unsigned int Tick = 0;
+
+		Vector3	   Position	   = Vector3::Zero;
+		Quaternion Orientation = Quaternion::Identity;
+		int		   ObjectID	   = 0;
+	};
+
+	struct RenderSnapshot
+	{
+		unsigned int Tick	   = 0;
+		double		 LogicTime = 0.0; // In sync ticks.
+
+		CameraSnapshot				Camera	= {};
+		std::vector<ItemSnapshot>	Items	= {}; // Indexed by item number.
+		std::vector<EffectSnapshot> Effects = {}; // Indexed by effect number.
+
+		bool HasItem(int itemNumber) const;
+		bool HasEffect(int fxNumber) const;
+	};
+
+	class RenderSnapshotBuffer
+	{
+	private:
+		// Constants
+		static constexpr auto TICK_LENGTH = 2.0; // Sync ticks per logic tick.
+
+		// Members
+		std::array<RenderSnapshot, 2> Snapshots = {};
+
+		unsigned int CurrentIndex  = 0;
+		unsigned int TickCount	   = 0;
+		float		 BuildTime	   = 0.0f; // In milliseconds.
+		unsigned int CapturedItems = 0;
+
+	public:
+		// Getters
+		RenderSnapshot&		  GetCurrent();
+		RenderSnapshot&		  GetPrevious();
+		const RenderSnapshot& GetCurrent() const;
+		const RenderSnapshot& GetPrevious() const;
+		float				  GetBuildTime() const;
+		unsigned int		  GetCapturedItemCount() const;
+		float				  GetAlpha(double time) const;
+
+		// Inquirers
+		bool CanInterpolate() const;
+
+		// Utilities
+		RenderSnapshot& BeginSnapshot(double logicTime);
+		void			EndSnapshot(float buildTime, unsigned int capturedItemCount);
+		void			Clear();
+
+		CameraSnapshot		GetInterpolatedCamera(float alpha) const;
+		bool				GetInterpolatedItemPose(int itemNumber, float alpha, Vector3& outPos, Quaternion& outOrient) const;
+		bool				GetInterpolatedEffectPose(int fxNumber, float alpha, Vector3& outPos, Quaternion& outOrient) const;
+		AnimFrameInterpData GetInterpolatedFrameData(int itemNumber, float alpha);
+	};
+
+	extern RenderSnapshotBuffer RenderSnapshots;
+
+	// Pure helpers
+	CameraSnapshot InterpolateCamera(const CameraSnapshot& prev, const CameraSnapshot& current, float alpha);
+	void		   InterpolatePose(const Vector3& prevPos, const Quaternion& prevOrient, const Vector3& pos, const Quaternion& orient,
+								   float alpha, Vector3& outPos, Quaternion& outOrient);
+	void		   BlendFrame(const AnimFrame& frame0, const AnimFrame& frame1, float alpha, AnimFrame& outFrame);
+
+	// Game state capture
+	void RegisterCameraSnapshot(const Vector3& pos, const Vector3& target, int roomNumber, float roll, float fov, float farView);
+	void CaptureItemSnapshot(const ItemInfo& item, ItemSnapshot& snapshot, unsigned int tick);
+	void CaptureRenderSnapshot(double logicTime);
+}
@@ -206,25 +206,18 @@ bool PickupTrigger(short itemNum)
 	return true;
 }
 
-void RefreshCamera(short type, short* data)
+void RefreshCamera(const TriggerRecord& record)
 {
-	short trigger, value, targetOk;
+	short targetOk = 2;
 
-	targetOk = 2;
-
-	do
+	for (const auto& action : record.Actions)
 	{
-		trigger = *(data++);
-		value = trigger & VALUE_BITS;
-
-		switch (TRIG_BITS(trigger))
+		switch (action.Type)
 		{
 		case TO_CAMERA:
-			data++;
-
-			if (value == Camera.last)
+			if (action.Value == Camera.last)
 			{
-				Camera.number = value;
+				Camera.number = action.Value;
 
 				if ((Camera.timer < 0) || (Camera.type == CameraType::Look) || (Camera.type == CameraType::Combat))
 				{
@@ -243,10 +236,10 @@ void RefreshCamera(short type, short* data)
 			if (Camera.type == CameraType::Look || Camera.type == CameraType::Combat)
 				break;
 
-			Camera.item = &g_Level.Items[value];
+			Camera.item = &g_Level.Items[action.Value];
 			break;
 		}
-	} while (!(trigger & END_BIT));
+	}
 
 	if (Camera.item)
 		if (!targetOk || (targetOk == 2 && Camera.item->LookedAt && Camera.item != Camera.lastItem))
@@ -273,6 +266,104 @@ short* GetTriggerIndex(ItemInfo* item)
 	return GetTriggerIndex(floor, item->Pose.Position.x, item->Pose.Position.y, item->Pose.Position.z);
 }
 
+const TriggerRecord* GetTriggerRecord(FloorInfo* floor, int x, int y, int z)
+{
+	auto bottomBlock = GetCollision(x, y, z, floor->Room).BottomBlock;
+
+	if (bottomBlock->TriggerRecordIndex == -1)
+		return nullptr;
+
+	return &g_Level.Triggers[bottomBlock->TriggerRecordIndex];
+}
+
+static std::optional<TriggerRecord> CompileTrigger(int triggerIndex)
+{
+	const auto& data = g_Level.FloorData;
+
+	if (triggerIndex < 0 || (triggerIndex + 2) > data.size())
+	{
+		TENLog("Trigger index " + std::to_string(triggerIndex) + " is outside of floordata.", LogLevel::Warning);
+		return std::nullopt;
+	}
+
+	auto record = TriggerRecord{};
+	record.Type = (data[triggerIndex] >> 8) & 0x3F;
+	record.Flags = data[triggerIndex + 1];
+	record.Timer = record.Flags & TIMER_BITS;
+
+	int dataIndex = triggerIndex + 2;
+	while (true)
+	{
+		if (dataIndex >= data.size())
+		{
+			TENLog("Trigger at floordata index " + std::to_string(triggerIndex) + " is not terminated.", LogLevel::Warning);
+			break;
+		}
+
+		short word = data[dataIndex++];
+
+		auto action = TriggerAction{};
+		action.Type = (word >> 10) & FUNCTION_BITS;
+		action.Value = word & VALUE_BITS;
+
+		// Camera, flyby and Lua event actions are followed by parameter word, which carries end bit instead.
+		if (action.Type == TO_CAMERA || action.Type == TO_FLYBY || action.Type == TO_LUAEVENT)
+		{
+			if (dataIndex >= data.size())
+			{
+				TENLog("Trigger at floordata index " + std::to_string(triggerIndex) + " is not terminated.", LogLevel::Warning);
+				break;
+			}
+
+			word = data[dataIndex++];
+			action.Extra = word;
+		}
+
+		record.Actions.push_back(action);
+
+		if (word & END_BIT)
+			break;
+	}
+
+	return record;
+}
+
+void CompileTriggers()
+{
+	g_Level.Triggers.clear();
+
+	// Sectors sharing same floordata share compiled record.
+	auto recordIndices = std::map<int, int>{};
+
+	for (auto& room : g_Level.Rooms)
+	{
+		for (auto& sector : room.floor)
+		{
+			sector.TriggerRecordIndex = -1;
+
+			if (sector.TriggerIndex == -1)
+				continue;
+
+			auto it = recordIndices.find(sector.TriggerIndex);
+			if (it != recordIndices.end())
+			{
+				sector.TriggerRecordIndex = it->second;
+				continue;
+			}
+
+			auto record = CompileTrigger(sector.TriggerIndex);
+			if (!record.has_value())
+				continue;
+
+			sector.TriggerRecordIndex = (int)g_Level.Triggers.size();
+			recordIndices.insert({ sector.TriggerIndex, sector.TriggerRecordIndex });
+			g_Level.Triggers.push_back(std::move(*record));
+		}
+	}
+
+	TENLog("Num triggers: " + std::to_string(g_Level.Triggers.size()), LogLevel::Info, LogConfig::Debug);
+}
+
 void Antitrigger(short const value, short const flags)
 {
 	ItemInfo* item = &g_Level.Items[value];
@@ -355,18 +446,20 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 	short cameraTimer = 0;
 	int spotCamIndex = 0;
 
-	auto data = GetTriggerIndex(floor, x, y, z);
+	auto* record = GetTriggerRecord(floor, x, y, z);
 
-	if (!data)
+	if (!record)
 		return;
 
-	short triggerType = (*(data++) >> 8) & 0x3F;
-	short flags = *(data++);
-	short timer = flags & TIMER_BITS;
+	short triggerType = record->Type;
+	short flags = record->Flags;
+	short timer = record->Timer;
 
 	if (Camera.type != CameraType::Heavy)
-		RefreshCamera(triggerType, data);
+		RefreshCamera(*record);
 
+	// Switch, key and pickup triggers use first action as their activating item.
+	int actionIndex = 0;
 	short value = 0;
 
 	if (heavy)
@@ -404,7 +497,10 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 		switch (triggerType)
 		{
 		case TRIGGER_TYPES::SWITCH:
-			value = *(data++) & VALUE_BITS;
+			if (record->Actions.empty())
+				return;
+
+			value = record->Actions[actionIndex++].Value;
 
 			if (flags & ONESHOT)
 				g_Level.Items[value].ItemFlags[0] = 1;
@@ -467,14 +563,20 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 			return;
 
 		case TRIGGER_TYPES::KEY:
-			value = *(data++) & VALUE_BITS;
+			if (record->Actions.empty())
+				return;
+
+			value = record->Actions[actionIndex++].Value;
 			keyResult = KeyTrigger(value);
 			if (keyResult != -1)
 				break;
 			return;
 
 		case TRIGGER_TYPES::PICKUP:
-			value = *(data++) & VALUE_BITS;
+			if (record->Actions.empty())
+				return;
+
+			value = record->Actions[actionIndex++].Value;
 			if (!PickupTrigger(value))
 				return;
 			break;
@@ -495,19 +597,18 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 		}
 	}
 
-	short targetType = 0;
 	short trigger = 0;
 
 	ItemInfo* item = NULL;
 	ItemInfo* cameraItem = NULL;
 
-	do
+	for (; actionIndex < record->Actions.size(); actionIndex++)
 	{
-		trigger = *(data++);
-		value = trigger & VALUE_BITS;
-		targetType = (trigger >> 10) & FUNCTION_BITS;
+		const auto& action = record->Actions[actionIndex];
+		value = action.Value;
+		trigger = action.Extra;
 
-		switch (targetType)
+		switch (action.Type)
 		{
 		case TO_OBJECT:
 			item = &g_Level.Items[value];
@@ -583,8 +684,6 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 			break;
 
 		case TO_CAMERA:
-			trigger = *(data++);
-
 			if (keyResult == 1)
 				break;
 
@@ -612,8 +711,6 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 			break;
 
 		case TO_FLYBY:
-			trigger = *(data++);
-
 			if (keyResult == 1)
 				break;
 
@@ -718,8 +815,6 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 			break;
 
 		case TO_LUAEVENT:
-			trigger = *(data++);
-
 			if (g_Level.EventSets.size() > value)
 			{
 				auto& set = g_Level.EventSets[value];
@@ -748,8 +843,7 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 		default:
 			break;
 		}
-
-	} while (!(trigger & END_BIT));
+	}
 
 	if (cameraItem && (Camera.type == CameraType::Fixed || Camera.type == CameraType::Heavy))
 		Camera.item = cameraItem;
@@ -63,6 +63,23 @@ enum TRIGOBJECTS_TYPES
 	TO_LUAEVENT
 };
 
+// Trigger floordata decoded at level load. Sectors reference records by FloorInfo::TriggerRecordIndex.
+struct TriggerAction
+{
+	int	  Type	= TO_OBJECT; // TRIGOBJECTS_TYPES
+	int	  Value = 0;
+	short Extra = 0; // Parameter word of camera, flyby and Lua event actions.
+};
+
+struct TriggerRecord
+{
+	int	  Type	= TRIGGER; // TRIGGER_TYPES
+	short Flags = 0;
+	short Timer = 0;
+
+	std::vector<TriggerAction> Actions = {};
+};
+
 extern int TriggerTimer;
 extern int KeyTriggerActive;
 
@@ -71,10 +88,12 @@ int GetSwitchTrigger(ItemInfo* item, short* itemNos, int attatchedToSwitch);
 int SwitchTrigger(short itemNumber, short timer);
 int KeyTrigger(short itemNum);
 bool PickupTrigger(short itemNum);
-void RefreshCamera(short type, short* data);
+void RefreshCamera(const TriggerRecord& record);
 int TriggerActive(ItemInfo* item);
 short* GetTriggerIndex(FloorInfo* floor, int x, int y, int z);
 short* GetTriggerIndex(ItemInfo* item);
+const TriggerRecord* GetTriggerRecord(FloorInfo* floor, int x, int y, int z);
+void CompileTriggers();
 void TestTriggers(int x, int y, int z, short roomNumber, bool heavy, int heavyFlags = 0);
 void TestTriggers(ItemInfo* item, bool heavy, int heavyFlags = 0);
 void ProcessSectorFlags(ItemInfo* item);
@@ -1,60 +1,139 @@
 #include "framework.h"
 #include "Game/debug/debug.h"
 
+#include <mutex>
 #include <spdlog.h>
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+// Messages are queued and written by background thread, so that logging never waits on disk.
+// If queue is full, oldest messages are dropped and reported with next logged message.
+constexpr auto LOG_QUEUE_SIZE	  = 8192;
+constexpr auto LOG_FLUSH_INTERVAL = 1; // Default until configuration is loaded.
+
+static std::shared_ptr<spdlog::logger> Logger = nullptr;
+
+static std::mutex  LogMutex		= {};
+static std::string LastLogString	= {};
+static LogLevel	   LastLogLevel		= LogLevel::Info;
+static int		   LogRepeatCount	= 0;
+static size_t	   LogDropCount		= 0;
+
+static void WriteTENLog(std::string_view str, LogLevel level)
+{
+	switch (level)
+	{
+	case LogLevel::Error:
+		Logger->error(str);
+		break;
+	case LogLevel::Warning:
+		Logger->warn(str);
+		break;
+	case LogLevel::Info:
+		Logger->info(str);
+		break;
+	}
+}
+
+static void WritePendingTENLogNotes()
+{
+	if (LogRepeatCount > 0)
+	{
+		WriteTENLog("Previous message repeated " + std::to_string(LogRepeatCount) + " times.", LastLogLevel);
+		LogRepeatCount = 0;
+	}
+
+	size_t dropCount = spdlog::thread_pool()->overrun_counter();
+	if (dropCount > LogDropCount)
+	{
+		WriteTENLog(std::to_string(dropCount - LogDropCount) + " log messages were dropped due to full log queue.", LogLevel::Warning);
+		LogDropCount = dropCount;
+	}
+}
+
 void InitTENLog()
 {
+	spdlog::init_thread_pool(LOG_QUEUE_SIZE, 1);
+
 	// "true" means that we create a new log file each time we run the game.
 	auto fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>("Logs/TENLog.txt", true);
 
-	std::shared_ptr<spdlog::logger> logger;
-
 	// Set the file and console log targets.
 	auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-	logger = std::make_shared<spdlog::logger>(std::string{ "multi_sink" }, spdlog::sinks_init_list{ fileSink, consoleSink });
+	Logger = std::make_shared<spdlog::async_logger>(
+		std::string{ "multi_sink" }, spdlog::sinks_init_list{ fileSink, consoleSink },
+		spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
 	
-	spdlog::initialize_logger(logger);
-    logger->set_level(spdlog::level::info);
-	logger->flush_on(spdlog::level::info);
-	logger->set_pattern("[%Y-%b-%d %T] [%^%l%$] %v");
+	spdlog::initialize_logger(Logger);
+	Logger->set_level(spdlog::level::info);
+	Logger->set_pattern("[%Y-%b-%d %T] [%^%l%$] %v");
+
+	SetTENLogFlushPolicy(LOG_FLUSH_INTERVAL, LogLevel::Error);
 }
 
-void TENLog(std::string_view str, LogLevel level, LogConfig config, bool allowSpam)
+// Messages of flush level or higher severity are flushed immediately, other messages periodically.
+void SetTENLogFlushPolicy(int intervalSeconds, LogLevel flushLevel)
 {
-	static std::string lastString = {};
-
-	if (lastString == str && !allowSpam)
+	if (Logger == nullptr)
 		return;
 
-	if constexpr (!DebugBuild)
-	{
-		if (LogConfig::Debug == config)
-			return;
-	}
-
-	auto logger = spdlog::get("multi_sink");
-	switch (level)
+	switch (flushLevel)
 	{
 	case LogLevel::Error:
-		logger->error(str);
+		Logger->flush_on(spdlog::level::err);
 		break;
 	case LogLevel::Warning:
-		logger->warn(str);
+		Logger->flush_on(spdlog::level::warn);
 		break;
 	case LogLevel::Info:
-		logger->info(str);
+		Logger->flush_on(spdlog::level::info);
 		break;
 	}
 
-	logger->flush();
+	// Zero interval stops periodic flushing.
+	spdlog::flush_every(std::chrono::seconds(std::max(intervalSeconds, 0)));
+}
 
-	lastString = std::string(str);
+void TENLog(std::string_view str, LogLevel level, LogConfig config, bool allowSpam)
+{
+	if constexpr (!DebugBuild)
+	{
+		if (LogConfig::Debug == config)
+			return;
+	}
+
+	auto lock = std::lock_guard<std::mutex>(LogMutex);
+
+	// Checked under lock, as ShutdownTENLog() may reset logger from another thread.
+	if (Logger == nullptr)
+		return;
+
+	// Coalesce repeated messages into single note written before next different message.
+	if (LastLogString == str && !allowSpam)
+	{
+		LogRepeatCount++;
+		return;
+	}
+
+	WritePendingTENLogNotes();
+	WriteTENLog(str, level);
+
+	LastLogString = std::string(str);
+	LastLogLevel = level;
 }
 
 void ShutdownTENLog()
 {
+	{
+		auto lock = std::lock_guard<std::mutex>(LogMutex);
+		if (Logger != nullptr)
+		{
+			WritePendingTENLogNotes();
+			Logger = nullptr;
+		}
+	}
+
+	// Writes remaining queued messages before joining writer thread.
 	spdlog::shutdown();
 }
@@ -25,6 +25,7 @@ enum class LogConfig
 void TENLog(std::string_view str, LogLevel level = LogLevel::Info, LogConfig config = LogConfig::All, bool allowSpam = false);
 void ShutdownTENLog();
 void InitTENLog();
+void SetTENLogFlushPolicy(int intervalSeconds, LogLevel flushLevel);
 
 class TENScriptException : public std::runtime_error
 {
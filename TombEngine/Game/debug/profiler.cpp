@@ -0,0 +1,273 @@
+#include "framework.h"
+#include "Game/debug/profiler.h"
+
+#include <fstream>
+#include <unordered_map>
+
+#include "Game/debug/debug.h"
+#include "Game/items.h"
+
+namespace TEN::Debug
+{
+	FrameProfiler g_Profiler = {};
+
+	static std::string EscapeJsonString(const std::string& string)
+	{
+		auto result = std::string{};
+		result.reserve(string.size());
+
+		for (char character : string)
+		{
+			switch (character)
+			{
+			case '"':
+				result += "\\\"";
+				break;
+
+			case '\\':
+				result += "\\\\";
+				break;
+
+			default:
+				if ((unsigned char)character >= ' ')
+					result += character;
+
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	float ProfileFrame::GetDuration() const
+	{
+		return ((EndTime - StartTime) / 1000000.0f);
+	}
+
+	const ProfileEvent* ProfileFrame::GetSlowestObjectEvent() const
+	{
+		const ProfileEvent* slowestEvent = nullptr;
+		for (const auto& event : Events)
+		{
+			if (event.ObjectID < 0)
+				continue;
+
+			if (slowestEvent == nullptr || (event.EndTime - event.StartTime) > (slowestEvent->EndTime - slowestEvent->StartTime))
+				slowestEvent = &event;
+		}
+
+		return slowestEvent;
+	}
+
+	unsigned int FrameProfiler::GetFrameCount() const
+	{
+		return FrameCount;
+	}
+
+	const ProfileFrame* FrameProfiler::GetFrame(unsigned int age) const
+	{
+		if (age >= FrameCount)
+			return nullptr;
+
+		return &Frames[((FrameIndex + FRAME_COUNT_MAX) - 1 - age) % FRAME_COUNT_MAX];
+	}
+
+	void FrameProfiler::SetEnabled(bool value)
+	{
+		if (!value && IsFrameOpen)
+			EndFrame();
+
+		IsEnabled = value;
+	}
+
+	bool FrameProfiler::IsActive() const
+	{
+		// Scopes entered from worker threads are ignored, so event stack stays consistent.
+		return (IsEnabled && IsFrameOpen && std::this_thread::get_id() == OwnerThread);
+	}
+
+	void FrameProfiler::BeginFrame()
+	{
+		if (!IsEnabled)
+			return;
+
+		if (IsFrameOpen)
+			EndFrame();
+
+		// Event capacity is kept from previous use of this slot.
+		auto& frame = Frames[FrameIndex];
+		frame.Events.clear();
+		frame.Number = FrameNumber++;
+		frame.StartTime = GetTime();
+		frame.EndTime = frame.StartTime;
+		frame.DroppedEventCount = 0;
+
+		OwnerThread = std::this_thread::get_id();
+		OpenEventCount = 0;
+		IsFrameOpen = true;
+	}
+
+	void FrameProfiler::EndFrame()
+	{
+		if (!IsFrameOpen)
+			return;
+
+		auto& frame = GetOpenFrame();
+		frame.EndTime = GetTime();
+
+		// Close scopes which are still open, e.g. if frame ended from within a scope.
+		while (OpenEventCount > 0)
+			frame.Events[OpenEvents[--OpenEventCount]].EndTime = frame.EndTime;
+
+		FrameIndex = (FrameIndex + 1) % FRAME_COUNT_MAX;
+		FrameCount = std::min<unsigned int>(FrameCount + 1, FRAME_COUNT_MAX);
+		IsFrameOpen = false;
+	}
+
+	int FrameProfiler::BeginEvent(const char* name, int objectID, int index)
+	{
+		if (!IsActive())
+			return -1;
+
+		auto& frame = GetOpenFrame();
+		if (frame.Events.size() >= FRAME_EVENT_COUNT_MAX || OpenEventCount >= OPEN_EVENT_DEPTH_MAX)
+		{
+			frame.DroppedEventCount++;
+			return -1;
+		}
+
+		auto event = ProfileEvent{};
+		event.Name = name;
+		event.ObjectID = objectID;
+		event.Index = index;
+		event.Depth = OpenEventCount;
+		event.StartTime = GetTime();
+		event.EndTime = event.StartTime;
+
+		int eventIndex = (int)frame.Events.size();
+		frame.Events.push_back(event);
+		OpenEvents[OpenEventCount++] = eventIndex;
+		return eventIndex;
+	}
+
+	void FrameProfiler::EndEvent(int eventIndex)
+	{
+		if (eventIndex < 0 || !IsActive())
+			return;
+
+		// Event belongs to a frame which has already ended.
+		if (OpenEventCount == 0 || OpenEvents[OpenEventCount - 1] != eventIndex)
+			return;
+
+		GetOpenFrame().Events[eventIndex].EndTime = GetTime();
+		OpenEventCount--;
+	}
+
+	void FrameProfiler::Clear()
+	{
+		for (auto& frame : Frames)
+			frame.Events.clear();
+
+		FrameIndex = 0;
+		FrameCount = 0;
+		OpenEventCount = 0;
+		IsFrameOpen = false;
+	}
+
+	bool FrameProfiler::ExportChromeTrace(const std::string& path) const
+	{
+		auto file = std::ofstream(path, std::ios::out | std::ios::trunc);
+		if (!file.is_open())
+		{
+			TENLog("Could not open " + path + " for profiler trace export.", LogLevel::Warning);
+			return false;
+		}
+
+		// Timestamps and durations are in microseconds.
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		file << std::fixed;
+		file.precision(3);
+
+		bool isFirstEvent = true;
+		auto writeEvent = [&](const std::string& name, const char* category, long long startTime, long long endTime, const std::string& args)
+		{
+			if (!isFirstEvent)
+				file << ",\n";
+
+			file << "{\"name\":\"" << EscapeJsonString(name) << "\",\"cat\":\"" << category << "\",\"ph\":\"X\""
+				 << ",\"ts\":" << (startTime / 1000.0) << ",\"dur\":" << ((endTime - startTime) / 1000.0)
+				 << ",\"pid\":1,\"tid\":1";
+
+			if (!args.empty())
+				file << ",\"args\":{" << args << "}";
+
+			file << "}";
+			isFirstEvent = false;
+		};
+
+		// Object name lookup is linear, so cache names for duration of export.
+		auto objectNames = std::unordered_map<int, std::string>{};
+		auto getObjectName = [&](int objectID) -> const std::string&
+		{
+			auto it = objectNames.find(objectID);
+			if (it == objectNames.end())
+				it = objectNames.insert({ objectID, GetObjectName((GAME_OBJECT_ID)objectID) }).first;
+
+			return it->second;
+		};
+
+		for (int age = FrameCount - 1; age >= 0; age--)
+		{
+			const auto& frame = *GetFrame(age);
+
+			auto frameArgs = "\"frame\":" + std::to_string(frame.Number);
+			if (frame.DroppedEventCount > 0)
+				frameArgs += ",\"dropped\":" + std::to_string(frame.DroppedEventCount);
+
+			writeEvent("Frame " + std::to_string(frame.Number), "Frame", frame.StartTime, frame.EndTime, frameArgs);
+
+			for (const auto& event : frame.Events)
+			{
+				// Per-object scopes are named after object so offending creature or effect is visible at a glance.
+				if (event.ObjectID >= 0)
+				{
+					auto args = "\"scope\":\"" + EscapeJsonString(event.Name) + "\",\"object\":" + std::to_string(event.ObjectID);
+					if (event.Index >= 0)
+						args += ",\"index\":" + std::to_string(event.Index);
+
+					writeEvent(getObjectName(event.ObjectID), "Object", event.StartTime, event.EndTime, args);
+				}
+				else
+				{
+					writeEvent(event.Name, "Scope", event.StartTime, event.EndTime, "");
+				}
+			}
+		}
+
+		file << "\n]}\n";
+		file.close();
+
+		TENLog("Exported " + std::to_string(FrameCount) + " profiled frames to " + path + ".", LogLevel::Info);
+		return true;
+	}
+
+	long long FrameProfiler::GetTime() const
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Epoch).count();
+	}
+
+	ProfileFrame& FrameProfiler::GetOpenFrame()
+	{
+		return Frames[FrameIndex];
+	}
+
+	ProfileScope::ProfileScope(const char* name, int objectID, int index)
+	{
+		EventIndex = g_Profiler.BeginEvent(name, objectID, index);
+	}
+
+	ProfileScope::~ProfileScope()
+	{
+		g_Profiler.EndEvent(EventIndex);
+	}
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Lightweight scoped frame profiler. Scopes are recorded into a ring buffer of recent frames
+// and can be exported as Chrome trace-event JSON (chrome://tracing, Perfetto).
+// Profiler is compiled in only if TEN_PROFILER is defined (Debug configuration); otherwise all PROFILE_* macros expand to nothing.
+
+namespace TEN::Debug
+{
+	struct ProfileEvent
+	{
+		const char* Name	 = nullptr; // Must be a string literal or otherwise outlive the profiler.
+		int			ObjectID = -1;
+		int			Index	 = -1; // Item or effect number, if applicable.
+		int			Depth	 = 0;
+
+		long long StartTime = 0; // In nanoseconds since profiler start.
+		long long EndTime	= 0;
+	};
+
+	struct ProfileFrame
+	{
+		unsigned int Number			   = 0;
+		long long	 StartTime		   = 0;
+		long long	 EndTime		   = 0;
+		unsigned int DroppedEventCount = 0;
+
+		std::vector<ProfileEvent> Events = {};
+
+		float				GetDuration() const; // In milliseconds.
+		const ProfileEvent* GetSlowestObjectEvent() const;
+	};
+
+	class FrameProfiler
+	{
+	private:
+		// Constants
+		static constexpr auto FRAME_COUNT_MAX		= 120;
+		static constexpr auto FRAME_EVENT_COUNT_MAX = 8192;
+		static constexpr auto OPEN_EVENT_DEPTH_MAX	= 64;
+
+		// Members
+		std::array<ProfileFrame, FRAME_COUNT_MAX> Frames = {};
+		unsigned int FrameIndex	  = 0;
+		unsigned int FrameCount	  = 0;
+		unsigned int FrameNumber  = 0;
+		bool		 IsFrameOpen  = false;
+		bool		 IsEnabled	  = true;
+
+		std::chrono::steady_clock::time_point Epoch		  = std::chrono::steady_clock::now();
+		std::thread::id						  OwnerThread = {};
+
+		std::array<int, OPEN_EVENT_DEPTH_MAX> OpenEvents	 = {};
+		int									  OpenEventCount = 0;
+
+	public:
+		// Getters
+		unsigned int		GetFrameCount() const;
+		const ProfileFrame* GetFrame(unsigned int age) const; // 0 is last completed frame.
+
+		// Setters
+		void SetEnabled(bool value);
+
+		// Inquirers
+		bool IsActive() const;
+
+		// Utilities
+		void BeginFrame();
+		void EndFrame();
+		int	 BeginEvent(const char* name, int objectID = -1, int index = -1);
+		void EndEvent(int eventIndex);
+		void Clear();
+		bool ExportChromeTrace(const std::string& path) const;
+
+	private:
+		// Helpers
+		long long	  GetTime() const;
+		ProfileFrame& GetOpenFrame();
+	};
+
+	extern FrameProfiler g_Profiler;
+
+	constexpr auto PROFILER_TRACE_PATH = "Logs/TENProfile.json";
+
+	class ProfileScope
+	{
+	private:
+		int EventIndex = -1;
+
+	public:
+		ProfileScope(const char* name, int objectID = -1, int index = -1);
+		~ProfileScope();
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator =(const ProfileScope&) = delete;
+	};
+}
+
+#ifdef TEN_PROFILER
+	#define PROFILE_CONCAT_INNER(a, b) a##b
+	#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+	#define PROFILE_SCOPE(name) TEN::Debug::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+	#define PROFILE_SCOPE_OBJECT(name, objectID, index) TEN::Debug::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name, (int)(objectID), (int)(index))
+	#define PROFILE_CALL(call) { PROFILE_SCOPE(#call); call; }
+	#define PROFILE_BEGIN_FRAME() TEN::Debug::g_Profiler.BeginFrame()
+	#define PROFILE_END_FRAME() TEN::Debug::g_Profiler.EndFrame()
+#else
+	#define PROFILE_SCOPE(name)
+	#define PROFILE_SCOPE_OBJECT(name, objectID, index)
+	#define PROFILE_CALL(call) call
+	#define PROFILE_BEGIN_FRAME()
+	#define PROFILE_END_FRAME()
+#endif
@@ -259,3 +259,81 @@ void UpdateDebris()
 		}
 	}
 }
+
+const std::vector<RendererVertex>& DebrisBatchBuilder::GetVertices() const
+{
+	return Vertices;
+}
+
+const std::vector<DebrisBatch>& DebrisBatchBuilder::GetBatches() const
+{
+	return Batches;
+}
+
+void DebrisBatchBuilder::Build(const std::vector<DebrisFragment>& fragments, bool transparent)
+{
+	auto getBatchKey = [&fragments](int fragIndex)
+	{
+		const auto& frag = fragments[fragIndex];
+		return std::make_tuple(frag.isStatic, frag.mesh.tex, (int)frag.mesh.blendMode, frag.roomNumber, (int)frag.lightMode);
+	};
+
+	Vertices.clear();
+	Batches.clear();
+	Fragments.clear();
+
+	for (int i = 0; i < fragments.size(); i++)
+	{
+		const auto& frag = fragments[i];
+		if (!frag.active)
+			continue;
+
+		bool isOpaque = (frag.mesh.blendMode == BLENDMODE_OPAQUE || frag.mesh.blendMode == BLENDMODE_ALPHATEST);
+		if (isOpaque == transparent)
+			continue;
+
+		Fragments.push_back(i);
+	}
+
+	// Stable sort keeps fragment order within batch.
+	std::stable_sort(
+		Fragments.begin(), Fragments.end(),
+		[&getBatchKey](int fragIndex0, int fragIndex1) { return (getBatchKey(fragIndex0) < getBatchKey(fragIndex1)); });
+
+	Vertices.reserve(Fragments.size() * 3);
+
+	int prevFragIndex = NO_ITEM;
+	for (int fragIndex : Fragments)
+	{
+		const auto& frag = fragments[fragIndex];
+
+		if (prevFragIndex == NO_ITEM || getBatchKey(fragIndex) != getBatchKey(prevFragIndex))
+		{
+			auto batch = DebrisBatch{};
+			batch.Texture = frag.mesh.tex;
+			batch.IsStatic = frag.isStatic;
+			batch.BlendMode = frag.mesh.blendMode;
+			batch.LightMode = frag.lightMode;
+			batch.RoomNumber = frag.roomNumber;
+			batch.VertexStart = (unsigned int)Vertices.size();
+			Batches.push_back(batch);
+		}
+
+		// Bake fragment transform and color into vertices, so that whole batch is drawn with identity world matrix.
+		auto rotMatrix = Matrix::CreateFromQuaternion(frag.rotation);
+		auto worldMatrix = rotMatrix * Matrix::CreateTranslation(frag.worldPosition);
+
+		for (int i = 0; i < 3; i++)
+		{
+			auto vertex = RendererVertex{};
+			vertex.Position = Vector3::Transform(frag.mesh.Positions[i], worldMatrix);
+			vertex.Normal = Vector3::TransformNormal(frag.mesh.Normals[i], rotMatrix);
+			vertex.UV = frag.mesh.TextureCoordinates[i];
+			vertex.Color = frag.mesh.Colors[i] * frag.color;
+			Vertices.push_back(vertex);
+		}
+
+		Batches.back().VertexCount += 3;
+		prevFragIndex = fragIndex;
+	}
+}
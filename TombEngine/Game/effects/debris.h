@@ -72,6 +72,36 @@ struct DebrisFragment
 	bool isStatic;
 };
 
+// Debris fragments sharing texture and render state, packed as world space triangles.
+struct DebrisBatch
+{
+	int			Texture		= 0;
+	bool		IsStatic	= false;
+	BLEND_MODES BlendMode	= BLENDMODE_OPAQUE;
+	LIGHT_MODES LightMode	= LIGHT_MODE_DYNAMIC;
+	int			RoomNumber	= 0;
+
+	unsigned int VertexStart = 0;
+	unsigned int VertexCount = 0;
+};
+
+class DebrisBatchBuilder
+{
+private:
+	// Members
+	std::vector<TEN::Renderer::RendererVertex> Vertices  = {};
+	std::vector<DebrisBatch>				   Batches	 = {};
+	std::vector<int>						   Fragments = {}; // Fragment indices sorted by batch key.
+
+public:
+	// Getters
+	const std::vector<TEN::Renderer::RendererVertex>& GetVertices() const;
+	const std::vector<DebrisBatch>&					  GetBatches() const;
+
+	// Utilities
+	void Build(const std::vector<DebrisFragment>& fragments, bool transparent);
+};
+
 extern SHATTER_ITEM ShatterItem;
 extern std::vector<DebrisFragment> DebrisFragments;
 extern ShatterImpactInfo ShatterImpactData;
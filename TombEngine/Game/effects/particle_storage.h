@@ -0,0 +1,196 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <d3d11.h>
+#include <SimpleMath.h>
+
+namespace TEN::Effects
+{
+	// Number of particles processed together by storage kernels. Matches width of XMVECTOR.
+	constexpr auto PARTICLE_LANE_COUNT = 4;
+
+	// Per-component particle arrays, so kernels load one component of several particles at once.
+	template <int SIZE>
+	struct alignas(16) ParticleFloatArray : public std::array<float, SIZE>
+	{
+		DirectX::XMVECTOR LoadLanes(int index) const
+		{
+			return DirectX::XMLoadFloat4A((const DirectX::XMFLOAT4A*)&(*this)[index]);
+		}
+
+		void StoreLanes(int index, DirectX::FXMVECTOR value)
+		{
+			DirectX::XMStoreFloat4A((DirectX::XMFLOAT4A*)&(*this)[index], value);
+		}
+	};
+
+	template <int SIZE>
+	struct ParticleVector3Array
+	{
+		ParticleFloatArray<SIZE> X = {};
+		ParticleFloatArray<SIZE> Y = {};
+		ParticleFloatArray<SIZE> Z = {};
+
+		Vector3 Get(int index) const
+		{
+			return Vector3(X[index], Y[index], Z[index]);
+		}
+
+		void Set(int index, const Vector3& value)
+		{
+			X[index] = value.x;
+			Y[index] = value.y;
+			Z[index] = value.z;
+		}
+	};
+
+	template <int SIZE>
+	struct ParticleVector4Array
+	{
+		ParticleFloatArray<SIZE> X = {};
+		ParticleFloatArray<SIZE> Y = {};
+		ParticleFloatArray<SIZE> Z = {};
+		ParticleFloatArray<SIZE> W = {};
+
+		Vector4 Get(int index) const
+		{
+			return Vector4(X[index], Y[index], Z[index], W[index]);
+		}
+
+		void Set(int index, const Vector4& value)
+		{
+			X[index] = value.x;
+			Y[index] = value.y;
+			Z[index] = value.z;
+			W[index] = value.w;
+		}
+	};
+
+	// Structure-of-arrays particle storage with shared update kernels.
+	// Active particles are kept densely packed in [0, Count), so kernels run over contiguous arrays
+	// without per-particle activity tests. Expired particles are removed by swapping in last particle.
+	// Kernels process PARTICLE_LANE_COUNT particles per step. Lanes past Count in last step hold stale or
+	// zeroed data; results written there are never read, as every field is set when particle is added.
+	// State specific to one particle system is kept in Extras, which is moved together with particle.
+	template <typename TExtra, int SIZE>
+	struct ParticleStorage
+	{
+		static_assert((SIZE % PARTICLE_LANE_COUNT) == 0, "Particle storage size must be a multiple of lane count.");
+
+		static constexpr auto CAPACITY = SIZE;
+
+		int Count = 0;
+
+		ParticleVector3Array<SIZE> Positions		 = {};
+		ParticleVector3Array<SIZE> Velocities		 = {};
+		ParticleVector4Array<SIZE> SourceColors		 = {};
+		ParticleVector4Array<SIZE> DestinationColors = {};
+		ParticleVector4Array<SIZE> Colors			 = {};
+		ParticleFloatArray<SIZE>   Ages				 = {};
+		ParticleFloatArray<SIZE>   Lives			 = {};
+		ParticleFloatArray<SIZE>   Gravities		 = {};
+		ParticleFloatArray<SIZE>   Frictions		 = {};
+		std::array<int, SIZE>	   RoomNumbers		 = {};
+		std::array<TExtra, SIZE>   Extras			 = {};
+
+		// Returns index of new particle. If storage is full, first particle is replaced.
+		int Add()
+		{
+			if (Count < SIZE)
+				return Count++;
+
+			return 0;
+		}
+
+		void Clear()
+		{
+			Count = 0;
+		}
+
+		void Age(float step = 1.0f)
+		{
+			auto stepV = DirectX::XMVectorReplicate(step);
+			for (int i = 0; i < GetLaneEnd(); i += PARTICLE_LANE_COUNT)
+				Ages.StoreLanes(i, DirectX::XMVectorAdd(Ages.LoadLanes(i), stepV));
+		}
+
+		void RemoveExpired()
+		{
+			for (int i = Count - 1; i >= 0; i--)
+			{
+				if (Ages[i] > Lives[i])
+					Remove(i);
+			}
+		}
+
+		void ApplyGravity()
+		{
+			for (int i = 0; i < GetLaneEnd(); i += PARTICLE_LANE_COUNT)
+				Velocities.Y.StoreLanes(i, DirectX::XMVectorAdd(Velocities.Y.LoadLanes(i), Gravities.LoadLanes(i)));
+		}
+
+		void ApplyFriction()
+		{
+			for (int i = 0; i < GetLaneEnd(); i += PARTICLE_LANE_COUNT)
+			{
+				auto friction = Frictions.LoadLanes(i);
+				Velocities.X.StoreLanes(i, DirectX::XMVectorMultiply(Velocities.X.LoadLanes(i), friction));
+				Velocities.Y.StoreLanes(i, DirectX::XMVectorMultiply(Velocities.Y.LoadLanes(i), friction));
+				Velocities.Z.StoreLanes(i, DirectX::XMVectorMultiply(Velocities.Z.LoadLanes(i), friction));
+			}
+		}
+
+		void ApplyVelocity()
+		{
+			for (int i = 0; i < GetLaneEnd(); i += PARTICLE_LANE_COUNT)
+			{
+				Positions.X.StoreLanes(i, DirectX::XMVectorAdd(Positions.X.LoadLanes(i), Velocities.X.LoadLanes(i)));
+				Positions.Y.StoreLanes(i, DirectX::XMVectorAdd(Positions.Y.LoadLanes(i), Velocities.Y.LoadLanes(i)));
+				Positions.Z.StoreLanes(i, DirectX::XMVectorAdd(Positions.Z.LoadLanes(i), Velocities.Z.LoadLanes(i)));
+			}
+		}
+
+		void LerpColors()
+		{
+			for (int i = 0; i < GetLaneEnd(); i += PARTICLE_LANE_COUNT)
+			{
+				auto alpha = DirectX::XMVectorSaturate(DirectX::XMVectorDivide(Ages.LoadLanes(i), Lives.LoadLanes(i)));
+				Colors.X.StoreLanes(i, DirectX::XMVectorLerpV(SourceColors.X.LoadLanes(i), DestinationColors.X.LoadLanes(i), alpha));
+				Colors.Y.StoreLanes(i, DirectX::XMVectorLerpV(SourceColors.Y.LoadLanes(i), DestinationColors.Y.LoadLanes(i), alpha));
+				Colors.Z.StoreLanes(i, DirectX::XMVectorLerpV(SourceColors.Z.LoadLanes(i), DestinationColors.Z.LoadLanes(i), alpha));
+				Colors.W.StoreLanes(i, DirectX::XMVectorLerpV(SourceColors.W.LoadLanes(i), DestinationColors.W.LoadLanes(i), alpha));
+			}
+		}
+
+		float GetNormalizedAge(int index) const
+		{
+			return std::clamp(Ages[index] / Lives[index], 0.0f, 1.0f);
+		}
+
+	private:
+		// End of last lane step covering all active particles.
+		int GetLaneEnd() const
+		{
+			return ((Count + (PARTICLE_LANE_COUNT - 1)) / PARTICLE_LANE_COUNT) * PARTICLE_LANE_COUNT;
+		}
+
+		void Remove(int index)
+		{
+			int last = --Count;
+			if (index == last)
+				return;
+
+			Positions.Set(index, Positions.Get(last));
+			Velocities.Set(index, Velocities.Get(last));
+			SourceColors.Set(index, SourceColors.Get(last));
+			DestinationColors.Set(index, DestinationColors.Get(last));
+			Colors.Set(index, Colors.Get(last));
+			Ages[index] = Ages[last];
+			Lives[index] = Lives[last];
+			Gravities[index] = Gravities[last];
+			Frictions[index] = Frictions[last];
+			RoomNumbers[index] = RoomNumbers[last];
+			Extras[index] = Extras[last];
+		}
+	};
+}
@@ -17,76 +17,91 @@ using namespace TEN::Math;
 
 namespace TEN::Effects::Smoke
 {
-	std::array<SmokeParticle, 128> SmokeParticles;
+	ParticleStorage<SmokeParticleData, SMOKE_PARTICLE_COUNT_MAX> SmokeParticles = {};
 
-	auto& GetFreeSmokeParticle()
+	void DisableSmokeParticles()
 	{
-		for (int i = 0; i < SmokeParticles.size(); i++)
-		{
-			if (!SmokeParticles[i].active)
-				return SmokeParticles[i];
-		}
-
-		return SmokeParticles[0];
+		SmokeParticles.Clear();
 	}
 
-	void DisableSmokeParticles()
+	void SpawnSmokeParticle(const SmokeParticle& smoke)
 	{
-		for (int i = 0; i < SmokeParticles.size(); i++)
-			SmokeParticles[i].active = false;
+		int i = SmokeParticles.Add();
+
+		SmokeParticles.Positions.Set(i, smoke.position);
+		SmokeParticles.Velocities.Set(i, smoke.velocity);
+		SmokeParticles.SourceColors.Set(i, smoke.sourceColor);
+		SmokeParticles.DestinationColors.Set(i, smoke.destinationColor);
+		SmokeParticles.Colors.Set(i, smoke.sourceColor);
+		SmokeParticles.Ages[i] = smoke.age;
+		SmokeParticles.Lives[i] = smoke.life;
+		SmokeParticles.Gravities[i] = smoke.gravity;
+		SmokeParticles.Frictions[i] = smoke.friction;
+		SmokeParticles.RoomNumbers[i] = smoke.room;
+
+		auto& data = SmokeParticles.Extras[i];
+		data = {};
+		data.SourceSize = smoke.sourceSize;
+		data.DestinationSize = smoke.destinationSize;
+		data.Size = smoke.sourceSize;
+		data.AngularVelocity = smoke.angularVelocity;
+		data.AngularDrag = smoke.angularDrag;
+		data.TerminalVelocity = smoke.terminalVelocity;
+		data.AffectedByWind = smoke.affectedByWind;
 	}
 
 	void UpdateSmokeParticles()
 	{
-		for (int i = 0; i < SmokeParticles.size(); i++)
-		{
-			auto& s = SmokeParticles[i];
+		SmokeParticles.Age();
+		SmokeParticles.RemoveExpired();
+		SmokeParticles.ApplyGravity();
 
-			if (!s.active)
+		for (int i = 0; i < SmokeParticles.Count; i++)
+		{
+			float terminalVelocity = SmokeParticles.Extras[i].TerminalVelocity;
+			if (terminalVelocity == 0.0f)
 				continue;
 
-			s.age += 1;
-			if (s.age > s.life)
-			{
-				s.active = false;
-				continue;
-			}
+			auto velocity = SmokeParticles.Velocities.Get(i);
+			float velocityLength = velocity.Length();
+			if (velocityLength > terminalVelocity)
+				SmokeParticles.Velocities.Set(i, velocity * (terminalVelocity / velocityLength));
+		}
 
-			s.velocity.y += s.gravity;
+		SmokeParticles.ApplyVelocity();
 
-			if (s.terminalVelocity != 0)
-			{
-				float velocityLength = s.velocity.Length();
+		// Wind requires room query, so it is kept out of main kernels.
+		auto wind = Weather.Wind();
+		for (int i = 0; i < SmokeParticles.Count; i++)
+		{
+			if (!SmokeParticles.Extras[i].AffectedByWind)
+				continue;
 
-				if (velocityLength > s.terminalVelocity)
-					s.velocity *= (s.terminalVelocity / velocityLength);
+			if (TestEnvironment(ENV_FLAG_WIND, SmokeParticles.RoomNumbers[i]))
+			{
+				SmokeParticles.Positions.X[i] += wind.x;
+				SmokeParticles.Positions.Z[i] += wind.z;
 			}
+		}
 
-			s.position += s.velocity;
+		SmokeParticles.LerpColors();
 
-			if (s.affectedByWind)
-			{
-				if (TestEnvironment(ENV_FLAG_WIND, s.room))
-				{
-					s.position.x += Weather.Wind().x;
-					s.position.z += Weather.Wind().z;
-				}
-			}
+		int numSprites = -Objects[ID_SMOKE_SPRITES].nmeshes;
+		for (int i = 0; i < SmokeParticles.Count; i++)
+		{
+			auto& data = SmokeParticles.Extras[i];
+			float normalizedLife = SmokeParticles.GetNormalizedAge(i);
 
-			float normalizedLife = std::clamp(s.age / s.life,0.0f,1.0f);
-			s.size = Lerp(s.sourceSize, s.destinationSize, normalizedLife);
-			s.angularVelocity *= s.angularDrag;
-			s.rotation += s.angularVelocity;
-			s.color = DirectX::SimpleMath::Vector4::Lerp(s.sourceColor, s.destinationColor, normalizedLife);
-			int numSprites = -Objects[ID_SMOKE_SPRITES].nmeshes;
-			s.sprite = Lerp(0, numSprites - 1, normalizedLife);
+			data.Size = Lerp(data.SourceSize, data.DestinationSize, normalizedLife);
+			data.AngularVelocity *= data.AngularDrag;
+			data.Rotation += data.AngularVelocity;
+			data.Sprite = Lerp(0, numSprites - 1, normalizedLife);
 		}
 	}
 
 	void TriggerFlareSmoke(const Vector3& pos, const Vector3& direction, int life, int room)
 	{
-		auto& s = GetFreeSmokeParticle();
-		s = {};
+		auto s = SmokeParticle{};
 		s.position = pos;
 		s.age = 0;
 		constexpr float d = 0.2f;
@@ -106,17 +121,15 @@ namespace TEN::Effects::Smoke
 		s.sourceSize = life > 4 ? Random::GenerateFloat(16, 24) : Random::GenerateFloat(100, 128);
 		s.destinationSize = life > 4 ? Random::GenerateFloat(160, 200) : Random::GenerateFloat(256, 300);
 		s.affectedByWind = true;
-		s.active = true;
 		s.room = room;
+		SpawnSmokeParticle(s);
 	}
 
 	//TODO: add additional "Weapon Special" param or something. Currently initial == 2 means Rocket Launcher backwards smoke.
 	//TODO: Refactor different weapon types out of it
 	void TriggerGunSmokeParticles(int x, int y, int z, int xv, int yv, int zv, byte initial, LaraWeaponType weaponType, byte count)
 	{
-		auto& s = GetFreeSmokeParticle();
-		s = {};
-		s.active = true;
+		auto s = SmokeParticle{};
 		s.position = Vector3(x, y, z);
 
 		Vector3 direction = Vector3(xv, yv, zv);
@@ -189,12 +202,12 @@ namespace TEN::Effects::Smoke
 		s.angularVelocity = Random::GenerateFloat(-PI_DIV_4, PI_DIV_4);
 		s.angularDrag = 0.95f;
 		s.room = LaraItem->RoomNumber;
+		SpawnSmokeParticle(s);
 	}
 
 	void TriggerQuadExhaustSmoke(int x, int y, int z, short angle, int velocity, int moving)
 	{
-		auto& s = GetFreeSmokeParticle();
-		s = {};
+		auto s = SmokeParticle{};
 		s.position = Vector3(x, y, z) + Vector3(Random::GenerateFloat(8, 16), Random::GenerateFloat(8, 16), Random::GenerateFloat(8, 16));
 
 		float xVel = std::sin(TO_RAD(angle)) * velocity;
@@ -204,7 +217,6 @@ namespace TEN::Effects::Smoke
 		s.sourceColor = Vector4(1, 1, 1, 1);
 		s.destinationColor = Vector4(0, 0, 0, 0);
 		s.sourceSize = Random::GenerateFloat(8,24);
-		s.active = true;
 		s.affectedByWind = true;
 		s.friction = 0.999f;
 		s.gravity = -0.1f;
@@ -212,17 +224,16 @@ namespace TEN::Effects::Smoke
 		s.destinationSize = Random::GenerateFloat(128, 160);
 		s.angularVelocity = Random::GenerateFloat(-1, 1);
 		s.angularDrag = Random::GenerateFloat(0.97f, 0.999f);
+		SpawnSmokeParticle(s);
 	}
 
 	void TriggerRocketSmoke(int x, int y, int z)
 	{
-		auto& s = GetFreeSmokeParticle();
-		s = {};
+		auto s = SmokeParticle{};
 		s.position = Vector3(x, y, z) + Vector3(Random::GenerateFloat(8.0f, 16.0f), Random::GenerateFloat(8.0f, 16.0f), Random::GenerateFloat(8.0f, 16.0f));
 		s.sourceColor = Vector4(0.8f, 0.8f, 1, 1);
 		s.destinationColor = Vector4(0, 0, 0, 0);
 		s.sourceSize = Random::GenerateFloat(32.0f, 64.0f);
-		s.active = true;
 		s.velocity = Random::GenerateDirection() * Random::GenerateFloat(1.0f, 3.0f);
 		s.affectedByWind = true;
 		s.friction = 0.979f;
@@ -231,12 +242,12 @@ namespace TEN::Effects::Smoke
 		s.destinationSize = Random::GenerateFloat(1024, 1152);
 		s.angularVelocity = Random::GenerateFloat(-0.6f, 0.6f);
 		s.angularDrag = Random::GenerateFloat(0.87f, 0.99f);
+		SpawnSmokeParticle(s);
 	}
 
 	void SpawnCorpseEffect(const Vector3& pos)
 	{
-		auto& smoke = GetFreeSmokeParticle();
-		smoke = {};
+		auto smoke = SmokeParticle{};
 
 		auto sphere = BoundingSphere(pos, Random::GenerateFloat(8.0f, 16.0f));
 		auto spherePos = Random::GeneratePointInSphere(sphere);
@@ -245,7 +256,6 @@ namespace TEN::Effects::Smoke
 		smoke.sourceColor = Vector4(0.8f, 0.8f, 0.0f, 1.0f);
 		smoke.destinationColor = Vector4::Zero;
 		smoke.sourceSize = Random::GenerateFloat(32.0f, 64.0f);
-		smoke.active = true;
 		smoke.velocity = Random::GenerateDirection() * Random::GenerateFloat(0.1f, 0.2f);
 		smoke.affectedByWind = true;
 		smoke.friction = 0.9f;
@@ -254,12 +264,12 @@ namespace TEN::Effects::Smoke
 		smoke.destinationSize = Random::GenerateFloat(BLOCK(1), BLOCK(1.1f));
 		smoke.angularVelocity = Random::GenerateFloat(-0.1f, 0.1f);
 		smoke.angularDrag = Random::GenerateFloat(0.8f, 0.9f);
+		SpawnSmokeParticle(smoke);
 	}
 
 	void TriggerBreathSmoke(long x, long y, long z, short angle)
 	{
-		auto& s = GetFreeSmokeParticle();
-		s = {};
+		auto s = SmokeParticle{};
 		s.position = Vector3(x, y, z) + Vector3(Random::GenerateFloat(8, 16), Random::GenerateFloat(8, 16), Random::GenerateFloat(8, 16));
 
 		float xVel = std::sin(TO_RAD(angle)) * Random::GenerateFloat(8, 12);
@@ -269,7 +279,6 @@ namespace TEN::Effects::Smoke
 		s.sourceColor = Vector4(1, 1, 1, 0.7f);
 		s.destinationColor = Vector4(1, 1, 1, 0);
 		s.sourceSize = Random::GenerateFloat(8, 24);
-		s.active = true;
 		s.affectedByWind = true;
 		s.friction = 0.999f;
 		s.gravity = -0.1f;
@@ -277,5 +286,6 @@ namespace TEN::Effects::Smoke
 		s.destinationSize = Random::GenerateFloat(128, 160);
 		s.angularVelocity = Random::GenerateFloat(-0.5f, 0.5f);
 		s.angularDrag = Random::GenerateFloat(0.95f, 0.95f);
+		SpawnSmokeParticle(s);
 	}
 }
@@ -1,37 +1,51 @@
 #pragma once
+#include "Game/effects/particle_storage.h"
 
 enum class LaraWeaponType;
 struct ItemInfo;
 
 namespace TEN::Effects::Smoke
 {
+	constexpr auto SMOKE_PARTICLE_COUNT_MAX = 128;
+
+	// Spawn parameters of smoke particle.
 	struct SmokeParticle
 	{
 		Vector4 sourceColor;
 		Vector4 destinationColor;
-		Vector4 color;
 		Vector3 position;
 		Vector3 velocity;
 		int room;
-		int sprite;
 		float gravity;
 		float friction;
 		float sourceSize;
 		float destinationSize;
-		float size;
 		float age;
 		float life;
 		float angularVelocity;
 		float angularDrag;
-		float rotation;
 		float terminalVelocity;
 		bool affectedByWind;
-		bool active;
 	};
-	extern std::array<SmokeParticle, 128> SmokeParticles;
+
+	struct SmokeParticleData
+	{
+		int	  Sprite		   = 0;
+		float SourceSize	   = 0.0f;
+		float DestinationSize  = 0.0f;
+		float Size			   = 0.0f;
+		float AngularVelocity  = 0.0f;
+		float AngularDrag	   = 0.0f;
+		float Rotation		   = 0.0f;
+		float TerminalVelocity = 0.0f;
+		bool  AffectedByWind   = false;
+	};
+
+	extern ParticleStorage<SmokeParticleData, SMOKE_PARTICLE_COUNT_MAX> SmokeParticles;
 
 	void UpdateSmokeParticles();
 	void DisableSmokeParticles();
+	void SpawnSmokeParticle(const SmokeParticle& smoke);
 	void TriggerFlareSmoke(const Vector3& pos, const Vector3& direction, int life, int room);
 	void TriggerGunSmokeParticles(int x, int y, int z, int xv, int yv, int zv, byte initial, LaraWeaponType weaponType, byte count);
 	void TriggerQuadExhaustSmoke(int x, int y, int z, short angle, int velocity, int moving);
@@ -13,51 +13,43 @@ using namespace TEN::Math::Random;
 
 namespace TEN::Effects::Spark
 {
-	std::array<SparkParticle, 128> SparkParticles;
+	ParticleStorage<SparkParticleData, SPARK_PARTICLE_COUNT_MAX> SparkParticles = {};
 
 	void UpdateSparkParticles()
 	{
-		for (int i = 0; i < SparkParticles.size(); i++)
-		{
-			auto& s = SparkParticles[i];
-
-			if (!s.active)
-				continue;
-
-			s.age += 1;
-			if (s.age > s.life)
-			{
-				s.active = false;
-				continue;
-			}
-
-			s.velocity.y += s.gravity;
-			s.velocity *= s.friction;
-			s.pos += s.velocity;
-		}
+		SparkParticles.Age();
+		SparkParticles.RemoveExpired();
+		SparkParticles.ApplyGravity();
+		SparkParticles.ApplyFriction();
+		SparkParticles.ApplyVelocity();
+		SparkParticles.LerpColors();
 	}
 
 	void DisableSparkParticles()
 	{
-		for (int i = 0; i < SparkParticles.size(); i++)
-			SparkParticles[i].active = false;
+		SparkParticles.Clear();
 	}
 
-	SparkParticle& GetFreeSparkParticle()
+	void SpawnSparkParticle(const SparkParticle& spark)
 	{
-		for (int i = 0; i < SparkParticles.size(); i++)
-		{
-			if (!SparkParticles[i].active)
-				return SparkParticles[i];
-		}
-
-		return SparkParticles[0];
+		int i = SparkParticles.Add();
+
+		SparkParticles.Positions.Set(i, spark.pos);
+		SparkParticles.Velocities.Set(i, spark.velocity);
+		SparkParticles.SourceColors.Set(i, spark.sourceColor);
+		SparkParticles.DestinationColors.Set(i, spark.destinationColor);
+		SparkParticles.Colors.Set(i, spark.sourceColor);
+		SparkParticles.Ages[i] = spark.age;
+		SparkParticles.Lives[i] = spark.life;
+		SparkParticles.Gravities[i] = spark.gravity;
+		SparkParticles.Frictions[i] = spark.friction;
+		SparkParticles.RoomNumbers[i] = spark.room;
+		SparkParticles.Extras[i] = SparkParticleData{ spark.width, spark.height };
 	}
 
 	void TriggerFlareSparkParticles(const Vector3i& pos, const Vector3i& vel, const ColorData& color, int roomNumber)
 	{
-		auto& s = GetFreeSparkParticle();
-		s = {};
+		auto s = SparkParticle{};
 		s.age = 0;
 		s.life = GenerateFloat(10, 20);
 		s.friction = 0.98f;
@@ -72,15 +64,14 @@ namespace TEN::Effects::Spark
 		s.velocity = v *GenerateFloat(17,24);
 		s.sourceColor = Vector4::One;
 		s.destinationColor = Vector4(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, 1.0f);
-		s.active = true;
+		SpawnSparkParticle(s);
 	}
 
 	void TriggerRicochetSpark(const GameVector& pos, short angle, int count, const Vector4& colorStart)
 	{
 		for (int i = 0; i < count; i++) 
 		{
-			auto& s = GetFreeSparkParticle();
-			s = {};
+			auto s = SparkParticle{};
 			s.age = 0;
 			s.life = GenerateFloat(10, 20);
 			s.friction = 0.98f;
@@ -96,7 +87,7 @@ namespace TEN::Effects::Spark
 			s.velocity = v * GenerateFloat(17, 24);
 			s.sourceColor = colorStart;
 			s.destinationColor = Vector4::Zero;
-			s.active = true;
+			SpawnSparkParticle(s);
 		}
 	}
 
@@ -104,8 +95,7 @@ namespace TEN::Effects::Spark
 	{
 		for (int i = 0; i < count; i++)
 		{
-			auto& s = GetFreeSparkParticle();
-			s = {};
+			auto s = SparkParticle{};
 			s.age = 0;
 			s.life = GenerateFloat(8, 15);
 			s.friction = 0.1f;
@@ -121,7 +111,7 @@ namespace TEN::Effects::Spark
 			s.velocity = v * GenerateFloat(32, 64);
 			s.sourceColor = Vector4(1, 0.7f, 0.4f, 1);
 			s.destinationColor = Vector4(0.4f, 0.1f, 0, 0.5f);
-			s.active = true;
+			SpawnSparkParticle(s);
 		}
 	}
 
@@ -129,8 +119,7 @@ namespace TEN::Effects::Spark
 	{
 		for (int i = 0; i < count; i++)
 		{
-			auto& s = GetFreeSparkParticle();
-			s = {};
+			auto s = SparkParticle{};
 			s.age = 0;
 			s.life = GenerateFloat(8, 15);
 			s.friction = 1.0f;
@@ -146,7 +135,7 @@ namespace TEN::Effects::Spark
 			s.velocity = v * GenerateFloat(8, 32);
 			s.sourceColor = Vector4(0.4f, 0.6f, 1.0f, 1);
 			s.destinationColor = Vector4(0.6f, 0.6f, 0.8f, 0.8f);
-			s.active = true;
+			SpawnSparkParticle(s);
 		}
 	}
 
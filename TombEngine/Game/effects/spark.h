@@ -1,19 +1,21 @@
 #pragma once
 #include <d3d11.h>
 #include <SimpleMath.h>
+#include "Game/effects/particle_storage.h"
 #include "Math/Math.h"
 
 namespace TEN::Effects::Spark
 {
+	constexpr auto SPARK_PARTICLE_COUNT_MAX		= 128;
 	constexpr auto SPARK_RICOCHET_COLOR_DEFAULT = Vector4(1.0f, 1.0f, 0.0f, 1.0f);
 
+	// Spawn parameters of spark particle.
 	struct SparkParticle
 	{
 		Vector3 pos;
 		Vector3 velocity;
 		Vector4 sourceColor;
 		Vector4 destinationColor;
-		Vector4 color;
 		int room;
 		float gravity;
 		float friction;
@@ -21,13 +23,19 @@ namespace TEN::Effects::Spark
 		float life;
 		float width;
 		float height;
-		bool active;
 	};
-	extern std::array<SparkParticle, 128> SparkParticles;
-			
+
+	struct SparkParticleData
+	{
+		float Width	 = 0.0f;
+		float Height = 0.0f;
+	};
+
+	extern ParticleStorage<SparkParticleData, SPARK_PARTICLE_COUNT_MAX> SparkParticles;
+
 	void UpdateSparkParticles();
 	void DisableSparkParticles();
-	SparkParticle& GetFreeSparkParticle();
+	void SpawnSparkParticle(const SparkParticle& spark);
 
 	void TriggerFlareSparkParticles(const Vector3i& pos, const Vector3i& vel, const ColorData& color, int roomNumber);
 	void TriggerRicochetSpark(const GameVector& pos, short angle, int num, const Vector4& colorStart = SPARK_RICOCHET_COLOR_DEFAULT);
@@ -136,10 +136,10 @@ namespace TEN::Effects::Environment
 				if (!StormTimer)
 					SoundEffect(SFX_TR4_THUNDER_RUMBLE, NULL);
 			}
-			else if (!(rand() & 0x7F))
+			else if (!(GetRandomControl() & 0x7F))
 			{
-				StormCount = (rand() & 0x1F) + 16;
-				StormTimer = (rand() & 3) + 12;
+				StormCount = (GetRandomControl() & 0x1F) + 16;
+				StormTimer = (GetRandomControl() & 3) + 12;
 			}
 		}
 
@@ -181,7 +181,7 @@ namespace TEN::Effects::Environment
 		}
 		else if (StormCount)
 		{
-			StormRand = ((rand() & 0x1FF - StormRand) >> 1) + StormRand;
+			StormRand = ((GetRandomControl() & 0x1FF - StormRand) >> 1) + StormRand;
 			StormSkyColor2 += StormRand * StormSkyColor2 >> 8;
 			StormSkyColor = StormSkyColor2;
 			if (StormSkyColor > UCHAR_MAX)
@@ -406,9 +406,9 @@ namespace TEN::Effects::Environment
 	{
 		for (int i = 0; i < DUST_SPAWN_DENSITY; i++)
 		{
-			int xPos = Camera.pos.x + rand() % DUST_SPAWN_RADIUS - DUST_SPAWN_RADIUS / 2.0f;
-			int yPos = Camera.pos.y + rand() % DUST_SPAWN_RADIUS - DUST_SPAWN_RADIUS / 2.0f;
-			int zPos = Camera.pos.z + rand() % DUST_SPAWN_RADIUS - DUST_SPAWN_RADIUS / 2.0f;
+			int xPos = Camera.pos.x + GetRandomControl() % DUST_SPAWN_RADIUS - DUST_SPAWN_RADIUS / 2.0f;
+			int yPos = Camera.pos.y + GetRandomControl() % DUST_SPAWN_RADIUS - DUST_SPAWN_RADIUS / 2.0f;
+			int zPos = Camera.pos.z + GetRandomControl() % DUST_SPAWN_RADIUS - DUST_SPAWN_RADIUS / 2.0f;
 
 			// Use fast GetFloor instead of GetCollision as we spawn a lot of dust.
 			short roomNumber = Camera.pos.RoomNumber;
@@ -4,7 +4,9 @@
 #include "Game/collision/floordata.h"
 #include "Game/collision/collide_room.h"
 #include "Game/control/control.h"
+#include "Game/control/scheduler.h"
 #include "Game/control/volume.h"
+#include "Game/debug/profiler.h"
 #include "Game/effects/effects.h"
 #include "Game/effects/item_fx.h"
 #include "Game/Lara/lara.h"
@@ -20,6 +22,7 @@
 #include "Specific/setup.h"
 #include "Scripting/Internal/TEN/Objects/ObjectIDs.h"
 
+using namespace TEN::Control::Scheduler;
 using namespace TEN::Control::Volumes;
 using namespace TEN::Effects::Items;
 using namespace TEN::Floordata;
@@ -283,6 +286,9 @@ void AddActiveItem(short itemNumber)
 		item->NextActive = NextItemActive;
 		NextItemActive = itemNumber;
 	}
+
+	// Triggered items are woken even if their room is out of view.
+	g_ItemScheduler.Wake(itemNumber);
 }
 
 void ItemNewRoom(short itemNumber, short roomNumber)
@@ -715,14 +721,27 @@ void UpdateAllItems()
 {
 	InItemControlLoop = true;
 
+	g_ItemScheduler.BeginFrame();
+
 	short itemNumber = NextItemActive;
 	while (itemNumber != NO_ITEM)
 	{
 		auto* item = &g_Level.Items[itemNumber];
 		short nextItem = item->NextActive;
 
+		if (!g_ItemScheduler.TestTick(itemNumber))
+		{
+			itemNumber = nextItem;
+			continue;
+		}
+
 		if (item->AfterDeath <= ITEM_DEATH_TIMEOUT)
 		{
+			PROFILE_SCOPE_OBJECT("UpdateItem", item->ObjectNumber, itemNumber);
+
+			// Creature decisions draw from separate stream, so that AI changes don't alter other gameplay randomness.
+			auto streamScope = Random::RandomStreamScope(item->IsCreature() ? Random::RandomStream::AI : Random::RandomStream::Gameplay);
+
 			if (Objects[item->ObjectNumber].control)
 				Objects[item->ObjectNumber].control(itemNumber);
 
@@ -753,6 +772,8 @@ void UpdateAllEffects()
 	{
 		short nextFx = EffectList[fxNumber].nextActive;
 		auto* fx = &EffectList[fxNumber];
+		PROFILE_SCOPE_OBJECT("UpdateEffect", fx->objectNumber, fxNumber);
+
 		if (Objects[fx->objectNumber].control)
 			Objects[fx->objectNumber].control(fxNumber);
 
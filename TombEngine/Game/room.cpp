@@ -15,7 +15,7 @@ byte FlipStatus = 0;
 int FlipStats[MAX_FLIPMAP];
 int FlipMap[MAX_FLIPMAP];
 
-std::vector<short> OutsideRoomTable[OUTSIDE_SIZE][OUTSIDE_SIZE];
+OutsideRoomTable OutsideRooms = {};
 
 bool ROOM_INFO::Active()
 {
@@ -27,8 +27,6 @@ bool ROOM_INFO::Active()
 
 void DoFlipMap(short group)
 {
-	ROOM_INFO temp;
-
 	for (size_t i = 0; i < g_Level.Rooms.size(); i++)
 	{
 		auto* room = &g_Level.Rooms[i];
@@ -39,9 +37,8 @@ void DoFlipMap(short group)
 
 			auto* flipped = &g_Level.Rooms[room->flippedRoom];
 
-			temp = *room;
-			*room = *flipped;
-			*flipped = temp;
+			// Swap moves level arena allocated geometry instead of copying it into new arena memory.
+			std::swap(*room, *flipped);
 
 			room->flippedRoom = flipped->flippedRoom;
 			flipped->flippedRoom = -1;
@@ -119,20 +116,109 @@ bool IsObjectInRoom(short roomNumber, short objectNumber)
 	return true;
 }
 
-int IsRoomOutside(int x, int y, int z)
+std::pair<const short*, const short*> OutsideRoomTable::GetRoomNumbers(int x, int z) const
 {
 	if (x < 0 || z < 0)
-		return NO_ROOM;
+		return { nullptr, nullptr };
+
+	int cellX = (x / SECTOR(1)) - MinX;
+	int cellZ = (z / SECTOR(1)) - MinZ;
+
+	if (cellX < 0 || cellX >= SizeX ||
+		cellZ < 0 || cellZ >= SizeZ)
+	{
+		return { nullptr, nullptr };
+	}
+
+	int cellIndex = (cellX * SizeZ) + cellZ;
+	const short* roomNumbers = RoomNumbers.data();
+	return { roomNumbers + CellOffsets[cellIndex], roomNumbers + CellOffsets[cellIndex + 1] };
+}
+
+void OutsideRoomTable::Build(const std::vector<ROOM_INFO>& rooms)
+{
+	MinX = MinZ = INT_MAX;
+	int maxX = INT_MIN;
+	int maxZ = INT_MIN;
+
+	for (const auto& room : rooms)
+	{
+		int roomMinX, roomMinZ, roomMaxX, roomMaxZ;
+		if (!GetRoomSectorBounds(room, roomMinX, roomMinZ, roomMaxX, roomMaxZ))
+			continue;
+
+		MinX = std::min(MinX, roomMinX);
+		MinZ = std::min(MinZ, roomMinZ);
+		maxX = std::max(maxX, roomMaxX);
+		maxZ = std::max(maxZ, roomMaxZ);
+	}
+
+	if (MinX > maxX || MinZ > maxZ)
+	{
+		MinX = MinZ = SizeX = SizeZ = 0;
+		CellOffsets.clear();
+		RoomNumbers.clear();
+		return;
+	}
 
-	int xTable = x / SECTOR(1);
-	int zTable = z / SECTOR(1);
+	SizeX = (maxX - MinX) + 1;
+	SizeZ = (maxZ - MinZ) + 1;
 
-	if (OutsideRoomTable[xTable][zTable].size() == 0)
+	// Count rooms per cell, then convert counts to cell offsets and fill cells in room order.
+	CellOffsets.assign((SizeX * SizeZ) + 1, 0);
+	for (const auto& room : rooms)
+	{
+		int roomMinX, roomMinZ, roomMaxX, roomMaxZ;
+		if (!GetRoomSectorBounds(room, roomMinX, roomMinZ, roomMaxX, roomMaxZ))
+			continue;
+
+		for (int x = roomMinX; x <= roomMaxX; x++)
+		{
+			for (int z = roomMinZ; z <= roomMaxZ; z++)
+				CellOffsets[((x - MinX) * SizeZ) + (z - MinZ) + 1]++;
+		}
+	}
+
+	for (int i = 1; i < CellOffsets.size(); i++)
+		CellOffsets[i] += CellOffsets[i - 1];
+
+	auto fillOffsets = std::vector<int>(CellOffsets.begin(), CellOffsets.end() - 1);
+	RoomNumbers.resize(CellOffsets.back());
+
+	for (int i = 0; i < rooms.size(); i++)
+	{
+		int roomMinX, roomMinZ, roomMaxX, roomMaxZ;
+		if (!GetRoomSectorBounds(rooms[i], roomMinX, roomMinZ, roomMaxX, roomMaxZ))
+			continue;
+
+		for (int x = roomMinX; x <= roomMaxX; x++)
+		{
+			for (int z = roomMinZ; z <= roomMaxZ; z++)
+				RoomNumbers[fillOffsets[((x - MinX) * SizeZ) + (z - MinZ)]++] = i;
+		}
+	}
+}
+
+// Gets inclusive sector bounds of room interior, excluding border sectors.
+bool OutsideRoomTable::GetRoomSectorBounds(const ROOM_INFO& room, int& minX, int& minZ, int& maxX, int& maxZ) const
+{
+	minX = std::max((room.x / SECTOR(1)) + 1, 0);
+	minZ = std::max((room.z / SECTOR(1)) + 1, 0);
+	maxX = (room.x / SECTOR(1)) + room.xSize - 2;
+	maxZ = (room.z / SECTOR(1)) + room.zSize - 2;
+
+	return (minX <= maxX && minZ <= maxZ);
+}
+
+int IsRoomOutside(int x, int y, int z)
+{
+	if (x < 0 || z < 0)
 		return NO_ROOM;
 
-	for (size_t i = 0; i < OutsideRoomTable[xTable][zTable].size(); i++)
+	auto [roomNumberIt, roomNumberEnd] = OutsideRooms.GetRoomNumbers(x, z);
+	for (; roomNumberIt != roomNumberEnd; roomNumberIt++)
 	{
-		short roomNumber = OutsideRoomTable[xTable][zTable][i];
+		short roomNumber = *roomNumberIt;
 		auto* room = &g_Level.Rooms[roomNumber];
 
 		if ((y > room->maxceiling && y < room->minfloor) &&
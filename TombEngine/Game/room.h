@@ -137,9 +137,35 @@ constexpr auto MAX_FLIPMAP = 256;
 constexpr auto NUM_ROOMS = 1024;
 constexpr auto NO_ROOM = -1;
 constexpr auto OUTSIDE_Z = 64;
-constexpr auto OUTSIDE_SIZE = 1024;
+
+// Sector grid of rooms used by IsRoomOutside().
+// Grid covers only sector extents of level. Room numbers of all cells are stored in one array,
+// with per-cell offsets into it, so table is built with two allocations and queried without any.
+class OutsideRoomTable
+{
+private:
+	// Members
+	int				   MinX		   = 0;
+	int				   MinZ		   = 0;
+	int				   SizeX	   = 0;
+	int				   SizeZ	   = 0;
+	std::vector<int>   CellOffsets = {}; // First room number index per cell, plus end offset.
+	std::vector<short> RoomNumbers = {};
+
+public:
+	// Getters
+	std::pair<const short*, const short*> GetRoomNumbers(int x, int z) const;
+
+	// Utilities
+	void Build(const std::vector<ROOM_INFO>& rooms);
+
+private:
+	// Helpers
+	bool GetRoomSectorBounds(const ROOM_INFO& room, int& minX, int& minZ, int& maxX, int& maxZ) const;
+};
 
 extern byte FlipStatus;
+extern OutsideRoomTable OutsideRooms;
 extern int FlipStats[MAX_FLIPMAP];
 extern int FlipMap[MAX_FLIPMAP];
 
@@ -27,6 +27,7 @@
 #include "Objects/TR5/Emitter/tr5_rats_emitter.h"
 #include "Objects/TR5/Emitter/tr5_bats_emitter.h"
 #include "Objects/TR5/Emitter/tr5_spider_emitter.h"
+#include "Objects/TR5/Object/tr5_pushableblock.h"
 #include "Sound/sound.h"
 #include "Specific/clock.h"
 #include "Specific/level.h"
@@ -42,6 +43,7 @@ using namespace TEN::Entities::Switches;
 using namespace TEN::Entities::TR4;
 using namespace TEN::Entities::Generic;
 using namespace TEN::Floordata;
+using namespace TEN::Math::Random;
 using namespace flatbuffers;
 
 namespace Save = TEN::Save;
@@ -149,14 +151,6 @@ Vector4 ToVector4(const Save::Vector4* vec)
 	return Vector4(vec->x(), vec->y(), vec->z(), vec->w());
 }
 
-#define SaveVec(Type, Data, TableBuilder, UnionType) \
-				auto data = std::get<(int)Type>(Data); \
-				TableBuilder vtb{ fbb }; \
-				Save::Vector3 saveVec = FromVector3(data); \
-				vtb.add_vec(&saveVec); \
-				auto vecOffset = vtb.Finish(); \
-				putDataInVec(UnionType, vecOffset);
-
 bool SaveGame::Save(int slot)
 {
 	auto fileName = std::string(SAVEGAME_PATH) + "savegame." + std::to_string(slot);
@@ -1094,102 +1088,9 @@ bool SaveGame::Save(int slot)
 		alternatePendulumOffset = alternatePendulumInfo.Finish();
 	}
 
-	std::vector<SavedVar> savedVars;
-
-	g_GameScript->GetVariables(savedVars);
-	
-	std::vector<flatbuffers::Offset<Save::UnionTable>> varsVec;
-	for (auto const& s : savedVars)
-	{
-		auto putDataInVec = [&varsVec, &fbb](Save::VarUnion type, auto const & offsetVar)
-		{
-			Save::UnionTableBuilder ut{ fbb };
-			ut.add_u_type(type);
-			ut.add_u(offsetVar.Union());
-			varsVec.push_back(ut.Finish());
-		};
-
-		if (std::holds_alternative<std::string>(s))
-		{
-			auto strOffset2 = fbb.CreateString(std::get<std::string>(s));
-			Save::stringTableBuilder stb{ fbb };
-			stb.add_str(strOffset2);
-			auto strOffset = stb.Finish();
-
-			putDataInVec(Save::VarUnion::str, strOffset);
-		}
-		else if (std::holds_alternative<double>(s))
-		{
-			Save::doubleTableBuilder dtb{ fbb };
-			dtb.add_scalar(std::get<double>(s));
-			auto doubleOffset = dtb.Finish();
-
-			putDataInVec(Save::VarUnion::num, doubleOffset);
-		}
-		else if (std::holds_alternative<bool>(s))
-		{
-			Save::boolTableBuilder btb{ fbb };
-			btb.add_scalar(std::get<bool>(s));
-			auto boolOffset = btb.Finish();
-
-			putDataInVec(Save::VarUnion::boolean, boolOffset);
-		}
-		else if (std::holds_alternative<IndexTable>(s))
-		{
-			std::vector<Save::KeyValPair> keyValVec;
-			auto& vec = std::get<IndexTable>(s);
-			for (auto& id : vec)
-			{
-				keyValVec.push_back(Save::KeyValPair(id.first, id.second));
-			}
-
-			auto vecOffset = fbb.CreateVectorOfStructs(keyValVec);
-			Save::ScriptTableBuilder stb{ fbb };
-			stb.add_keys_vals(vecOffset);
-			auto scriptTableOffset = stb.Finish();
-
-			putDataInVec(Save::VarUnion::tab, scriptTableOffset);
-		}
-		else if (std::holds_alternative<FuncName>(s))
-		{
-			std::string data = std::get<FuncName>(s).name;
-			auto strOffset = fbb.CreateString(data);
-			Save::funcNameTableBuilder ftb{ fbb };
-			ftb.add_str(strOffset);
-			auto funcNameOffset = ftb.Finish();
-
-			putDataInVec(Save::VarUnion::funcName, funcNameOffset);
-		}
-		else
-		{
-			switch (SavedVarType(s.index()))
-			{
-			case SavedVarType::Vec3:
-			{
-				SaveVec(SavedVarType::Vec3, s, Save::vec3TableBuilder, Save::VarUnion::vec3);
-			}
-			break;
-			case SavedVarType::Rotation:
-			{
-				SaveVec(SavedVarType::Rotation, s, Save::rotationTableBuilder, Save::VarUnion::rotation);
-			}
-			break;
-			case SavedVarType::Color:
-			{
-				Save::colorTableBuilder ctb{ fbb };
-				ctb.add_color(std::get<(int)SavedVarType::Color>(s));
-				auto offset = ctb.Finish();
-
-				putDataInVec(Save::VarUnion::color, offset);
-			}
-			break;
-			}
-		}
-	}
-	auto unionVec = fbb.CreateVector(varsVec);
-	Save::UnionVecBuilder uvb{ fbb };
-	uvb.add_members(unionVec);
-	auto unionVecOffset = uvb.Finish();
+	std::vector<byte> scriptVarsData;
+	g_GameScript->SaveVariables(scriptVarsData);
+	auto scriptVarsDataOffset = fbb.CreateVector(scriptVarsData);
 
 	std::vector<std::string> callbackVecPreControl;
 	std::vector<std::string> callbackVecPostControl;
@@ -1198,6 +1099,15 @@ bool SaveGame::Save(int slot)
 	auto stringsCallbackPreControl = fbb.CreateVectorOfStrings(callbackVecPreControl);
 	auto stringsCallbackPostControl = fbb.CreateVectorOfStrings(callbackVecPostControl);
 
+	// Random streams which affect game logic.
+	std::vector<uint32_t> randomState;
+	for (auto stream : { RandomStream::Gameplay, RandomStream::AI })
+	{
+		const auto& state = GetStream(stream).GetState();
+		randomState.insert(randomState.end(), state.begin(), state.end());
+	}
+	auto randomStateOffset = fbb.CreateVector(randomState);
+
 	Save::SaveGameBuilder sgb{ fbb };
 
 	sgb.add_header(headerOffset);
@@ -1242,9 +1152,10 @@ bool SaveGame::Save(int slot)
 		sgb.add_alternate_pendulum(alternatePendulumOffset);
 	}
 
-	sgb.add_script_vars(unionVecOffset);
+	sgb.add_script_vars_data(scriptVarsDataOffset);
 	sgb.add_callbacks_pre_control(stringsCallbackPreControl);
 	sgb.add_callbacks_post_control(stringsCallbackPostControl);
+	sgb.add_random_state(randomStateOffset);
 
 	auto sg = sgb.Finish();
 	fbb.Finish(sg);
@@ -1383,6 +1294,24 @@ bool SaveGame::Load(int slot)
 		ActionQueue[i] = (QueueState)s->action_queue()->Get(i);
 	}
 
+	// Restore random streams. Older savegames don't have them.
+	if (s->random_state() != nullptr)
+	{
+		int offset = 0;
+		for (auto stream : { RandomStream::Gameplay, RandomStream::AI })
+		{
+			if ((offset + RandomGenerator::STATE_SIZE) > s->random_state()->size())
+				break;
+
+			auto state = std::array<uint32_t, RandomGenerator::STATE_SIZE>{};
+			for (int i = 0; i < state.size(); i++)
+				state[i] = s->random_state()->Get(offset + i);
+
+			GetStream(stream).SetState(state);
+			offset += RandomGenerator::STATE_SIZE;
+		}
+	}
+
 	// Restore soundtracks
 	PlaySoundTrack(s->ambient_track()->str(), SoundTrackType::BGM, s->ambient_position());
 	PlaySoundTrack(s->oneshot_track()->str(), SoundTrackType::OneShot, s->oneshot_position());
@@ -1651,6 +1580,9 @@ bool SaveGame::Load(int slot)
 		}
 	}
 
+	// Pushables were restored at their saved positions.
+	RebuildStackIndex();
+
 	for (int i = 0; i < s->particles()->size(); i++)
 	{
 		auto* particleInfo = s->particles()->Get(i);
@@ -1986,62 +1918,71 @@ bool SaveGame::Load(int slot)
 		AlternatePendulum.rope = rope;
 	}
 
-	std::vector<SavedVar> loadedVars;
-
-	auto theVec = s->script_vars();
-	if (theVec)
+	// Script variables are stored as tagged binary stream. Savegames written before it hold them as flatbuffer union vector.
+	if (s->script_vars_data())
 	{
-		for (auto const& var : *(theVec->members()))
+		std::vector<byte> scriptVarsData(s->script_vars_data()->begin(), s->script_vars_data()->end());
+		g_GameScript->LoadVariables(scriptVarsData);
+	}
+	else
+	{
+		std::vector<SavedVar> loadedVars;
+
+		auto theVec = s->script_vars();
+		if (theVec)
 		{
-			if (var->u_type() == Save::VarUnion::num)
-			{
-				loadedVars.push_back(var->u_as_num()->scalar());
-			}
-			else if (var->u_type() == Save::VarUnion::boolean)
+			for (auto const& var : *(theVec->members()))
 			{
-				loadedVars.push_back(var->u_as_boolean()->scalar());
-			}
-			else if (var->u_type() == Save::VarUnion::str)
-			{
-				loadedVars.push_back(var->u_as_str()->str()->str());
-			}
-			else if (var->u_type() == Save::VarUnion::tab)
-			{
-				auto tab = var->u_as_tab()->keys_vals();
-				auto& loadedTab = loadedVars.emplace_back(IndexTable{});
+				if (var->u_type() == Save::VarUnion::num)
+				{
+					loadedVars.push_back(var->u_as_num()->scalar());
+				}
+				else if (var->u_type() == Save::VarUnion::boolean)
+				{
+					loadedVars.push_back(var->u_as_boolean()->scalar());
+				}
+				else if (var->u_type() == Save::VarUnion::str)
+				{
+					loadedVars.push_back(var->u_as_str()->str()->str());
+				}
+				else if (var->u_type() == Save::VarUnion::tab)
+				{
+					auto tab = var->u_as_tab()->keys_vals();
+					auto& loadedTab = loadedVars.emplace_back(IndexTable{});
 
-				for (auto const& p : *tab)
+					for (auto const& p : *tab)
+					{
+						std::get<IndexTable>(loadedTab).push_back(std::make_pair(p->key(), p->val()));
+					}
+				}
+				else if (var->u_type() == Save::VarUnion::vec3)
 				{
-					std::get<IndexTable>(loadedTab).push_back(std::make_pair(p->key(), p->val()));
+					auto stored = var->u_as_vec3()->vec();
+					SavedVar v;
+					v.emplace<(int)SavedVarType::Vec3>(ToVector3i(stored));
+					loadedVars.push_back(v);
+				}
+				else if (var->u_type() == Save::VarUnion::rotation)
+				{
+					auto stored = var->u_as_rotation()->vec();
+					SavedVar v;
+					v.emplace<(int)SavedVarType::Rotation>(ToVector3(stored));
+					loadedVars.push_back(v);
+				}
+				else if (var->u_type() == Save::VarUnion::color)
+				{
+					loadedVars.push_back((D3DCOLOR)var->u_as_color()->color());
+				}
+				else if (var->u_type() == Save::VarUnion::funcName)
+				{
+					loadedVars.push_back(FuncName{var->u_as_funcName()->str()->str()});
 				}
-			}
-			else if (var->u_type() == Save::VarUnion::vec3)
-			{
-				auto stored = var->u_as_vec3()->vec();
-				SavedVar v;
-				v.emplace<(int)SavedVarType::Vec3>(ToVector3i(stored));
-				loadedVars.push_back(v);
-			}
-			else if (var->u_type() == Save::VarUnion::rotation)
-			{
-				auto stored = var->u_as_rotation()->vec();
-				SavedVar v;
-				v.emplace<(int)SavedVarType::Rotation>(ToVector3(stored));
-				loadedVars.push_back(v);
-			}
-			else if (var->u_type() == Save::VarUnion::color)
-			{
-				loadedVars.push_back((D3DCOLOR)var->u_as_color()->color());
-			}
-			else if (var->u_type() == Save::VarUnion::funcName)
-			{
-				loadedVars.push_back(FuncName{var->u_as_funcName()->str()->str()});
-			}
 
+			}
 		}
-	}
 
-	g_GameScript->SetVariables(loadedVars);
+		g_GameScript->SetVariables(loadedVars);
+	}
 
 	std::vector<std::string> callbacksPreControlVec;
 	auto callbacksPreControlOffsetVec = s->callbacks_pre_control();
@@ -55,4 +55,66 @@ namespace TEN::Math
 		// Evaluate polynomial.
 		return (CUBE(alpha) * (alpha * (alpha * 6 - 15) + 10));
 	}
+
+	void SlerpArray(const Quaternion* quats0, const Quaternion* quats1, float alpha, int count, Quaternion* outQuats)
+	{
+		constexpr auto LANE_COUNT		 = 4;
+		constexpr auto ONE_MINUS_EPSILON = 1.0f - 0.00001f;
+
+		if (alpha <= 0.0f)
+		{
+			std::copy(quats0, quats0 + count, outQuats);
+			return;
+		}
+
+		// Blend 4 quaternions per step. Rows are transposed so each vector holds one component of 4 quaternions.
+		// Same math as XMQuaternionSlerp(): shortest arc, linear weights for nearly equal orientations.
+		auto alphaV = XMVectorReplicate(alpha);
+		auto oneMinusAlphaV = XMVectorReplicate(1.0f - alpha);
+		auto thresholdV = XMVectorReplicate(ONE_MINUS_EPSILON);
+
+		int i = 0;
+		for (; (i + LANE_COUNT) <= count; i += LANE_COUNT)
+		{
+			auto q0 = XMMatrixTranspose(XMMATRIX(
+				XMLoadFloat4(&quats0[i]), XMLoadFloat4(&quats0[i + 1]),
+				XMLoadFloat4(&quats0[i + 2]), XMLoadFloat4(&quats0[i + 3])));
+			auto q1 = XMMatrixTranspose(XMMATRIX(
+				XMLoadFloat4(&quats1[i]), XMLoadFloat4(&quats1[i + 1]),
+				XMLoadFloat4(&quats1[i + 2]), XMLoadFloat4(&quats1[i + 3])));
+
+			auto cosOmega = XMVectorMultiply(q0.r[0], q1.r[0]);
+			cosOmega = XMVectorMultiplyAdd(q0.r[1], q1.r[1], cosOmega);
+			cosOmega = XMVectorMultiplyAdd(q0.r[2], q1.r[2], cosOmega);
+			cosOmega = XMVectorMultiplyAdd(q0.r[3], q1.r[3], cosOmega);
+
+			auto sign = XMVectorSelect(g_XMOne, g_XMNegativeOne, XMVectorLess(cosOmega, g_XMZero));
+			cosOmega = XMVectorMultiply(cosOmega, sign);
+
+			auto sinOmega = XMVectorSqrt(XMVectorNegativeMultiplySubtract(cosOmega, cosOmega, g_XMOne));
+			auto omega = XMVectorATan2(sinOmega, cosOmega);
+			auto invSinOmega = XMVectorReciprocal(sinOmega);
+
+			auto scale0 = XMVectorMultiply(XMVectorSin(XMVectorMultiply(oneMinusAlphaV, omega)), invSinOmega);
+			auto scale1 = XMVectorMultiply(XMVectorSin(XMVectorMultiply(alphaV, omega)), invSinOmega);
+
+			auto isNearlyEqual = XMVectorGreaterOrEqual(cosOmega, thresholdV);
+			scale0 = XMVectorSelect(scale0, oneMinusAlphaV, isNearlyEqual);
+			scale1 = XMVectorMultiply(XMVectorSelect(scale1, alphaV, isNearlyEqual), sign);
+
+			auto result = XMMATRIX();
+			for (int j = 0; j < LANE_COUNT; j++)
+				result.r[j] = XMVectorMultiplyAdd(q1.r[j], scale1, XMVectorMultiply(q0.r[j], scale0));
+
+			result = XMMatrixTranspose(result);
+			for (int j = 0; j < LANE_COUNT; j++)
+				XMStoreFloat4(&outQuats[i + j], result.r[j]);
+		}
+
+		for (; i < count; i++)
+		{
+			auto quat = XMQuaternionSlerp(XMLoadFloat4(&quats0[i]), XMLoadFloat4(&quats1[i]), alpha);
+			XMStoreFloat4(&outQuats[i], quat);
+		}
+	}
 }
@@ -7,4 +7,6 @@ namespace TEN::Math
 	float InterpolateCubic(float value0, float value1, float value2, float value3, float alpha);
 	float Smoothstep(float alpha);
 	float Smoothstep(float value0, float value1, float alpha);
+
+	void SlerpArray(const Quaternion* quats0, const Quaternion* quats1, float alpha, int count, Quaternion* outQuats);
 }
@@ -91,6 +91,12 @@
 		return box;
 	}
 
+	BoundingSphere GameBoundingBox::ToBoundingSphere(const Pose& pose) const
+	{
+		auto center = pose.Position.ToVector3() + Vector3::Transform(GetCenter(), pose.Orientation.ToQuaternion());
+		return BoundingSphere(center, GetExtents().Length());
+	}
+
 	GameBoundingBox GameBoundingBox::operator +(const GameBoundingBox& bounds) const
 	{
 		return GameBoundingBox(
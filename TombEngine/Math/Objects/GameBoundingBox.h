@@ -41,6 +41,7 @@ struct ObjectInfo;
 		// Converters
 		BoundingOrientedBox ToBoundingOrientedBox(const Pose& pose) const;
 		BoundingOrientedBox ToBoundingOrientedBox(const Vector3& pos, const Quaternion& orient) const;
+		BoundingSphere		ToBoundingSphere(const Pose& pose) const;
 
 		// Operators
 		GameBoundingBox operator +(const GameBoundingBox& bounds) const;
@@ -1,22 +1,164 @@
 #include "framework.h"
 #include "Math/Random.h"
 
-#include <random>
-
 #include "Math/Constants.h"
 
 namespace TEN::Math::Random
 {
-	static std::mt19937 Engine;
+	constexpr auto DEFAULT_SEED = 0x54454E5F524E47ull;
+
+	// Streams must differ even if never explicitly seeded.
+	static auto Streams = []()
+	{
+		auto streams = std::array<RandomGenerator, (int)RandomStream::Count>{};
+		for (int i = 0; i < streams.size(); i++)
+			streams[i].Seed(DEFAULT_SEED + i);
+
+		return streams;
+	}();
+
+	static thread_local auto ActiveStream  = RandomStream::Gameplay;
+	static thread_local auto ThreadStreams = std::array<RandomGenerator*, (int)RandomStream::Count>{};
+
+	// SplitMix64, used to expand seeds into generator state.
+	static uint64_t SplitMix(uint64_t& value)
+	{
+		uint64_t result = (value += 0x9E3779B97F4A7C15ull);
+		result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ull;
+		result = (result ^ (result >> 27)) * 0x94D049BB133111EBull;
+		return (result ^ (result >> 31));
+	}
+
+	static uint32_t RotateLeft(uint32_t value, int count)
+	{
+		return ((value << count) | (value >> (32 - count)));
+	}
+
+	RandomGenerator::RandomGenerator(uint64_t seed)
+	{
+		Seed(seed);
+	}
+
+	const std::array<uint32_t, RandomGenerator::STATE_SIZE>& RandomGenerator::GetState() const
+	{
+		return State;
+	}
+
+	void RandomGenerator::SetState(const std::array<uint32_t, STATE_SIZE>& state)
+	{
+		// All-zero state is a fixed point of generator.
+		if (state[0] == 0 && state[1] == 0 && state[2] == 0 && state[3] == 0)
+			return;
+
+		State = state;
+	}
+
+	void RandomGenerator::Seed(uint64_t seed)
+	{
+		uint64_t value0 = SplitMix(seed);
+		uint64_t value1 = SplitMix(seed);
+
+		State[0] = (uint32_t)value0;
+		State[1] = (uint32_t)(value0 >> 32);
+		State[2] = (uint32_t)value1;
+		State[3] = (uint32_t)(value1 >> 32);
+	}
+
+	uint32_t RandomGenerator::Next()
+	{
+		uint32_t result = RotateLeft(State[1] * 5, 7) * 9;
+		uint32_t t = State[1] << 9;
+
+		State[2] ^= State[0];
+		State[3] ^= State[1];
+		State[1] ^= State[2];
+		State[0] ^= State[3];
+		State[2] ^= t;
+		State[3] = RotateLeft(State[3], 11);
+
+		return result;
+	}
+
+	uint32_t RandomGenerator::NextInRange(uint32_t range)
+	{
+		if (range == 0)
+			return Next();
+
+		// Multiply-shift range reduction with rejection of biased low products.
+		uint64_t product = (uint64_t)Next() * range;
+		auto low = (uint32_t)product;
+		if (low < range)
+		{
+			uint32_t threshold = (0u - range) % range;
+			while (low < threshold)
+			{
+				product = (uint64_t)Next() * range;
+				low = (uint32_t)product;
+			}
+		}
+
+		return (uint32_t)(product >> 32);
+	}
+
+	float RandomGenerator::NextFloat()
+	{
+		// Use upper 24 bits, which is float mantissa precision.
+		return ((Next() >> 8) * (1.0f / 16777216.0f));
+	}
+
+	void SetSeed(unsigned int seed)
+	{
+		for (int i = 0; i < Streams.size(); i++)
+			Streams[i].Seed(((uint64_t)i << 32) | seed);
+
+		// Some legacy effect code still uses CRT generator.
+		srand(seed);
+	}
+
+	RandomGenerator& GetStream(RandomStream stream)
+	{
+		auto* threadStream = ThreadStreams[(int)stream];
+		if (threadStream != nullptr)
+			return *threadStream;
+
+		return Streams[(int)stream];
+	}
+
+	RandomStream GetActiveStream()
+	{
+		return ActiveStream;
+	}
+
+	void SetActiveStream(RandomStream stream)
+	{
+		ActiveStream = stream;
+	}
+
+	void BindThreadStream(RandomStream stream, RandomGenerator* generator)
+	{
+		ThreadStreams[(int)stream] = generator;
+	}
+
+	RandomStreamScope::RandomStreamScope(RandomStream stream)
+	{
+		PrevStream = ActiveStream;
+		ActiveStream = stream;
+	}
+
+	RandomStreamScope::~RandomStreamScope()
+	{
+		ActiveStream = PrevStream;
+	}
 
 	int GenerateInt(int low, int high)
 	{
-		return (Engine() / (Engine.max() / (high - low + 1) + 1) + low);
+		auto range = (uint32_t)((int64_t)high - low + 1);
+		return (int)((int64_t)low + GetStream(ActiveStream).NextInRange(range));
 	}
 
 	float GenerateFloat(float low, float high)
 	{
-		return ((high - low) * Engine() / Engine.max() + low);
+		return ((high - low) * GetStream(ActiveStream).NextFloat() + low);
 	}
 
 	short GenerateAngle(short low, short high)
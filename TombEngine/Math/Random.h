@@ -2,6 +2,67 @@
 
 namespace TEN::Math::Random
 {
+	// Independent streams, so that e.g. visual effects or rendering at variable frame rate don't perturb gameplay randomness.
+	enum class RandomStream
+	{
+		Gameplay,
+		AI,
+		Effects,
+		Audio,
+		Render,
+
+		Count
+	};
+
+	// xoshiro128** generator with 128-bit state.
+	class RandomGenerator
+	{
+	public:
+		// Constants
+		static constexpr auto STATE_SIZE = 4;
+
+	private:
+		// Members
+		std::array<uint32_t, STATE_SIZE> State = {};
+
+	public:
+		// Constructors
+		RandomGenerator(uint64_t seed = 0);
+
+		// Getters
+		const std::array<uint32_t, STATE_SIZE>& GetState() const;
+
+		// Setters
+		void SetState(const std::array<uint32_t, STATE_SIZE>& state);
+
+		// Utilities
+		void	 Seed(uint64_t seed);
+		uint32_t Next();
+		uint32_t NextInRange(uint32_t range); // Unbiased value in range [0, range).
+		float	 NextFloat();				  // Value in range [0.0f, 1.0f).
+	};
+
+	// Stream control
+	void			 SetSeed(unsigned int seed); // Seeds all streams.
+	RandomGenerator& GetStream(RandomStream stream);
+	RandomStream	 GetActiveStream();
+	void			 SetActiveStream(RandomStream stream);
+	void			 BindThreadStream(RandomStream stream, RandomGenerator* generator); // Thread-local stream override. Pass nullptr to unbind.
+
+	// Selects stream used by value generation functions on current thread until end of scope.
+	class RandomStreamScope
+	{
+	private:
+		RandomStream PrevStream = RandomStream::Gameplay;
+
+	public:
+		RandomStreamScope(RandomStream stream);
+		~RandomStreamScope();
+
+		RandomStreamScope(const RandomStreamScope&) = delete;
+		RandomStreamScope& operator =(const RandomStreamScope&) = delete;
+	};
+
 	// Value generation
 	int	  GenerateInt(int low = 0, int high = SHRT_MAX);
 	float GenerateFloat(float low = 0.0f, float high = 1.0f);
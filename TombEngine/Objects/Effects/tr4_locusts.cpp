@@ -8,25 +8,22 @@
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
 #include "Math/Math.h"
+#include "Objects/Utils/SwarmHelpers.h"
 #include "Sound/sound.h"
 #include "Specific/level.h"
 
+using namespace TEN::Entities::Swarm;
 using namespace TEN::Math;
 
 namespace TEN::Entities::TR4 
 {
 	LOCUST_INFO Locusts[MAX_LOCUSTS];
 
+	static int NextLocust = 0;
+
 	int CreateLocust()
 	{
-		for (int i = 0; i < MAX_LOCUSTS; i++)
-		{
-			auto* locust = &Locusts[i];
-			if (!locust->on)
-				return i;
-		}
-
-		return NO_ITEM;
+		return GetFreeSwarmAgent(Locusts, NextLocust, [](const LOCUST_INFO& locust) { return locust.on; });
 	}
 
 	void SpawnLocust(ItemInfo* item)
@@ -202,6 +199,8 @@ namespace TEN::Entities::TR4
 	{
 		for (int i = 0; i < MAX_LOCUSTS; i++)
 			Locusts[i].on = false;
+
+		NextLocust = 0;
 	}
 
 	void DrawLocust()
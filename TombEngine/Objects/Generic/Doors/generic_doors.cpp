@@ -395,7 +395,10 @@ namespace TEN::Entities::Doors
 
 		if (floor != NULL)
 		{
+			// Bridge list may have changed or been recycled since snapshot was taken; keep live one.
+			int bridgeListIndex = floor->BridgeListIndex;
 			*doorPos->floor = doorPos->data;
+			floor->BridgeListIndex = bridgeListIndex;
 
 			short boxIndex = doorPos->block;
 			if (boxIndex != NO_BOX)
@@ -415,6 +418,7 @@ namespace TEN::Entities::Doors
 		{
 			floor->Box = NO_BOX;
 			floor->TriggerIndex = 0;
+			floor->TriggerRecordIndex = -1;
 
 			// FIXME: HACK!!!!!!!
 			// We should find a better way of dealing with doors using new floordata.
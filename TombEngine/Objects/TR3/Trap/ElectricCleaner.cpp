@@ -364,10 +364,7 @@ namespace TEN::Entities::Traps
 				byte c = Random::GenerateInt(0, 64) + 128;
 				TriggerDynamicLight(pos.x, pos.y, pos.z, 10, c >> 2, c >> 1, c);
 
-				auto& spark = GetFreeSparkParticle();
-
-				spark = {};
-				spark.active = true;
+				auto spark = SparkParticle{};
 				spark.age = 0;
 				float color = (192.0F + Random::GenerateFloat(0, 63.0F)) / 255.0F;
 				spark.sourceColor = Vector4(color / 4, color / 2, color, 1.0F);
@@ -383,6 +380,7 @@ namespace TEN::Entities::Traps
 				spark.velocity = v;
 				spark.pos = pos.ToVector3();
 				spark.room = item.RoomNumber;
+				SpawnSparkParticle(spark);
 			}
 		}
 	}
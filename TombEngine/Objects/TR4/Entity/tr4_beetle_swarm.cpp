@@ -8,7 +8,9 @@
 #include "Specific/level.h"
 #include "Math/Math.h"
 #include "Specific/setup.h"
+#include "Objects/Utils/SwarmHelpers.h"
 
+using namespace TEN::Entities::Swarm;
 using namespace TEN::Math;
 
 namespace TEN::Entities::TR4
@@ -16,6 +18,8 @@ namespace TEN::Entities::TR4
 	BeetleData BeetleSwarm[NUM_BEETLES];
 	int NextBeetle;
 
+	static SwarmProbeBatch BeetleProbes = {};
+
 	void InitialiseBeetleSwarm(short itemNumber)
 	{
 		auto* item = &g_Level.Items[itemNumber];
@@ -110,127 +114,113 @@ namespace TEN::Entities::TR4
 
 	short GetFreeBeetle()
 	{
-		auto* beetle = &BeetleSwarm[NextBeetle];
-		short result = NextBeetle;
-
-		int i = 0;
-		while (beetle->On)
-		{
-			if (result == NUM_BEETLES - 1)
-			{
-				beetle = &BeetleSwarm[0];
-				result = 0;
-			}
-			else
-			{
-				result++;
-				beetle++;
-			}
-
-			if (++i >= NUM_BEETLES)
-				return NO_ITEM;
-		}
-
-		NextBeetle = (result + 1) & (NUM_BEETLES - 1);
-		return result;
+		return GetFreeSwarmAgent(BeetleSwarm, NextBeetle, [](const BeetleData& beetle) { return beetle.On; });
 	}
 
 	void UpdateBeetleSwarm()
 	{
+		BeetleProbes.Clear();
+
 		for (int i = 0; i < NUM_BEETLES; i++)
 		{
 			auto* beetle = &BeetleSwarm[i];
 
-			if (beetle->On)
-			{
-				auto oldPos = beetle->Pose.Position;
+			if (!beetle->On)
+				continue;
 
-				beetle->Pose.Position.x += beetle->Velocity * phd_sin(beetle->Pose.Orientation.y);
-				beetle->Pose.Position.y += beetle->VerticalVelocity;
-				beetle->Pose.Position.z += beetle->Velocity * phd_cos(beetle->Pose.Orientation.y);
+			auto oldPos = beetle->Pose.Position;
 
-				beetle->VerticalVelocity += GRAVITY;
+			beetle->Pose.Position.x += beetle->Velocity * phd_sin(beetle->Pose.Orientation.y);
+			beetle->Pose.Position.y += beetle->VerticalVelocity;
+			beetle->Pose.Position.z += beetle->Velocity * phd_cos(beetle->Pose.Orientation.y);
 
-				int dx = LaraItem->Pose.Position.x - beetle->Pose.Position.x;
-				int dy = LaraItem->Pose.Position.y - beetle->Pose.Position.y;
-				int dz = LaraItem->Pose.Position.z - beetle->Pose.Position.z;
+			beetle->VerticalVelocity += GRAVITY;
 
-				short angle = phd_atan(dz, dx) - beetle->Pose.Orientation.y;
+			int dx = LaraItem->Pose.Position.x - beetle->Pose.Position.x;
+			int dz = LaraItem->Pose.Position.z - beetle->Pose.Position.z;
 
-				if (abs(dx) < 85 &&
-					abs(dy) < 85 &&
-					abs(dz) < 85)
+			short angle = phd_atan(dz, dx) - beetle->Pose.Orientation.y;
+
+			if (TestSwarmPlayerContact(beetle->Pose.Position, 85))
+			{
+				LaraItem->HitPoints--;
+				LaraItem->HitStatus = true;
+			}
+
+			if (beetle->Flags)
+			{
+				if (abs(dx) + abs(dz) <= SECTOR(1))
 				{
-					LaraItem->HitPoints--;
-					LaraItem->HitStatus = true;
-				}
+					if (beetle->Velocity & 1)
+						beetle->Pose.Orientation.y += ANGLE(2.8f);
+					else
+						beetle->Pose.Orientation.y -= ANGLE(2.8f);
 
-				if (beetle->Flags)
+					beetle->Velocity = 48 - Lara.Torch.IsLit * 64 - (abs(angle) / 128);
+					if (beetle->Velocity < -16)
+						beetle->Velocity = i & 0xF;
+				}
+				else
 				{
-					if (abs(dx) + abs(dz) <= SECTOR(1))
+					if (beetle->Velocity < (i & 0x1F) + 24)
+						beetle->Velocity++;
+					
+					if (abs(angle) >= ANGLE(22.5f))
 					{
-						if (beetle->Velocity & 1)
-							beetle->Pose.Orientation.y += ANGLE(2.8f);
+						if (angle >= 0)
+							beetle->Pose.Orientation.y += ANGLE(5.6f);
 						else
-							beetle->Pose.Orientation.y -= ANGLE(2.8f);
-
-						beetle->Velocity = 48 - Lara.Torch.IsLit * 64 - (abs(angle) / 128);
-						if (beetle->Velocity < -16)
-							beetle->Velocity = i & 0xF;
+							beetle->Pose.Orientation.y -= ANGLE(5.6f);
 					}
 					else
-					{
-						if (beetle->Velocity < (i & 0x1F) + 24)
-							beetle->Velocity++;
-						
-						if (abs(angle) >= ANGLE(22.5f))
-						{
-							if (angle >= 0)
-								beetle->Pose.Orientation.y += ANGLE(5.6f);
-							else
-								beetle->Pose.Orientation.y -= ANGLE(5.6f);
-						}
-						else
-							beetle->Pose.Orientation.y += 8 * (Wibble - i);
-					}
+						beetle->Pose.Orientation.y += 8 * (Wibble - i);
 				}
+			}
 
-				FloorInfo* floor = GetFloor(beetle->Pose.Position.x, beetle->Pose.Position.y, beetle->Pose.Position.z, &beetle->RoomNumber);
-				int height = GetFloorHeight(floor, beetle->Pose.Position.x, beetle->Pose.Position.y, beetle->Pose.Position.z);
-				if (height < (beetle->Pose.Position.y - SECTOR(1.25f)) || height == NO_HEIGHT)
-				{
-					// Beetle has hit a wall a high step.
-					if (angle <= 0)
-						beetle->Pose.Orientation.y -= ANGLE(90.0f);
-					else
-						beetle->Pose.Orientation.y += ANGLE(90.0f);
+			BeetleProbes.Add(i, beetle->Pose.Position, oldPos, beetle->RoomNumber, angle);
+		}
+
+		BeetleProbes.Resolve();
+
+		for (const auto& probe : BeetleProbes.GetProbes())
+		{
+			auto* beetle = &BeetleSwarm[probe.AgentIndex];
+			beetle->RoomNumber = probe.RoomNumber;
 
-					beetle->Pose.Position = oldPos;
+			int height = probe.FloorHeight;
+			if (height < (beetle->Pose.Position.y - SECTOR(1.25f)) || height == NO_HEIGHT)
+			{
+				// Beetle has hit a wall a high step.
+				if (probe.Angle <= 0)
+					beetle->Pose.Orientation.y -= ANGLE(90.0f);
+				else
+					beetle->Pose.Orientation.y += ANGLE(90.0f);
+
+				beetle->Pose.Position = probe.PrevPosition;
+				beetle->Pose.Orientation.x = 0;
+				beetle->Pose.Orientation.z = 0;
+				beetle->VerticalVelocity = 0;
+			}
+			else
+			{
+				// Beetle is below the floor.
+				if (beetle->Pose.Position.y > height)
+				{
+					beetle->Pose.Position.y = height;
 					beetle->Pose.Orientation.x = 0;
 					beetle->Pose.Orientation.z = 0;
 					beetle->VerticalVelocity = 0;
+					beetle->Flags = 1;
 				}
-				else
-				{
-					// Beetle is below the floor.
-					if (beetle->Pose.Position.y > height)
-					{
-						beetle->Pose.Position.y = height;
-						beetle->Pose.Orientation.x = 0;
-						beetle->Pose.Orientation.z = 0;
-						beetle->VerticalVelocity = 0;
-						beetle->Flags = 1;
-					}
-				}
+			}
 
-				if (beetle->VerticalVelocity >= 500)
-				{
-					NextBeetle = 0;
-					beetle->On = false;
-				}
-				else
-					beetle->Pose.Orientation.x = beetle->VerticalVelocity * -64;
+			if (beetle->VerticalVelocity >= 500)
+			{
+				NextBeetle = 0;
+				beetle->On = false;
 			}
+			else
+				beetle->Pose.Orientation.x = beetle->VerticalVelocity * -64;
 		}
 	}
 }
@@ -10,9 +10,12 @@
 #include "Game/effects/effects.h"
 #include "Game/effects/tomb4fx.h"
 #include "Objects/Generic/Switches/switch.h"
+#include "Objects/TR5/Object/tr5_pushableblock.h"
 #include "Specific/Input/Input.h"
 #include <Game/effects/debris.h>
 
+using namespace TEN::Entities::Generic;
+
 constexpr auto RIGHT_HAMMER_BITS = ((1 << 5) | (1 << 6) | (1 << 7));
 constexpr auto LEFT_HAMMER_BITS = ((1 << 8) | (1 << 9) | (1 << 10));
 constexpr auto HAMMER_HIT_DAMAGE = 150;
@@ -138,6 +141,7 @@ namespace TEN::Entities::TR4
                                     item->Pose.Position.z == target->Pose.Position.z)
                                 {
                                     ExplodeItemNode(target, 0, 0, 128);
+                                    RemovePushableFromStackIndex(targetItem);
                                     KillItem(targetItem);
                                     hammerTouched = 1;
                                 }
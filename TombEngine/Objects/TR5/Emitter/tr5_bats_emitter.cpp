@@ -11,7 +11,9 @@
 #include "Game/animation.h"
 #include "Game/items.h"
 #include "Math/Math.h"
+#include "Objects/Utils/SwarmHelpers.h"
 
+using namespace TEN::Entities::Swarm;
 using namespace TEN::Math;
 
 int NextBat;
@@ -54,32 +56,7 @@ void LittleBatsControl(short itemNumber)
 
 short GetNextBat()
 {
-	short batNumber = NextBat;
-	auto* bat = &Bats[NextBat];
-
-	int index = 0;
-	while (bat->On)
-	{
-		if (batNumber == NUM_BATS - 1)
-		{
-			bat = (BatData*)Bats;
-			batNumber = 0;
-		}
-		else
-		{
-			batNumber++;
-			bat++;
-		}
-
-		index++;
-
-		if (index >= NUM_BATS)
-			return NO_ITEM;
-	}
-
-	NextBat = (batNumber + 1) & (NUM_BATS - 1);
-
-	return batNumber;
+	return GetFreeSwarmAgent(Bats, NextBat, [](const BatData& bat) { return bat.On; });
 }
 
 void TriggerLittleBat(ItemInfo* item)
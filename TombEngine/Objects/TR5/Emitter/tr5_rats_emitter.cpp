@@ -10,39 +10,19 @@
 #include "Sound/sound.h"
 #include "Game/Lara/lara.h"
 #include "Game/items.h"
+#include "Objects/Utils/SwarmHelpers.h"
 
 using namespace TEN::Effects::Ripple;
+using namespace TEN::Entities::Swarm;
 
 int NextRat;
 RatData Rats[NUM_RATS];
 
+static SwarmProbeBatch RatProbes = {};
+
 short GetNextRat()
 {
-	short ratNumber = NextRat;
-	auto* rat = &Rats[NextRat];
-
-	int i = 0;
-	while (rat->On)
-	{
-		if (ratNumber == NUM_RATS - 1)
-		{
-			rat = &Rats[0];
-			ratNumber = 0;
-		}
-		else
-		{
-			ratNumber++;
-			rat++;
-		}
-
-		i++;
-
-		if (i >= NUM_RATS)
-			return NO_ITEM;
-	}
-
-	NextRat = (ratNumber + 1) & 0x1F;
-	return ratNumber;
+	return GetFreeSwarmAgent(Rats, NextRat, [](const RatData& rat) { return rat.On; });
 }
 
 void LittleRatsControl(short itemNumber)
@@ -132,168 +112,175 @@ void InitialiseLittleRats(short itemNumber)
 
 void UpdateRats()
 {
-	if (Objects[ID_RATS_EMITTER].loaded)
+	if (!Objects[ID_RATS_EMITTER].loaded)
+		return;
+
+	RatProbes.Clear();
+
+	for (int i = 0; i < NUM_RATS; i++)
 	{
-		for (int i = 0; i < NUM_RATS; i++)
-		{
-			auto* rat = &Rats[i];
+		auto* rat = &Rats[i];
 
-			if (rat->On)
-			{
-				int oldX = rat->Pose.Position.x;
-				int oldY = rat->Pose.Position.y;
-				int oldZ = rat->Pose.Position.z;
+		if (!rat->On)
+			continue;
 
-				rat->Pose.Position.x += rat->Velocity * phd_sin(rat->Pose.Orientation.y);
-				rat->Pose.Position.y += rat->VerticalVelocity;
-				rat->Pose.Position.z += rat->Velocity * phd_cos(rat->Pose.Orientation.y);
+		auto oldPos = rat->Pose.Position;
 
-				rat->VerticalVelocity += GRAVITY;
+		rat->Pose.Position.x += rat->Velocity * phd_sin(rat->Pose.Orientation.y);
+		rat->Pose.Position.y += rat->VerticalVelocity;
+		rat->Pose.Position.z += rat->Velocity * phd_cos(rat->Pose.Orientation.y);
 
-				int dx = LaraItem->Pose.Position.x - rat->Pose.Position.x;
-				int dy = LaraItem->Pose.Position.y - rat->Pose.Position.y;
-				int dz = LaraItem->Pose.Position.z - rat->Pose.Position.z;
+		rat->VerticalVelocity += GRAVITY;
 
-				short angle;
-				if (rat->Flags >= 170)
-					angle = rat->Pose.Orientation.y - (short)phd_atan(dz, dx);
-				else
-					angle = (short)phd_atan(dz, dx) - rat->Pose.Orientation.y;
+		int dx = LaraItem->Pose.Position.x - rat->Pose.Position.x;
+		int dz = LaraItem->Pose.Position.z - rat->Pose.Position.z;
 
-				if (abs(dx) < 85 && abs(dy) < 85 && abs(dz) < 85)
-				{
-					LaraItem->HitPoints--;
-					LaraItem->HitStatus = true;
-				}
+		short angle;
+		if (rat->Flags >= 170)
+			angle = rat->Pose.Orientation.y - (short)phd_atan(dz, dx);
+		else
+			angle = (short)phd_atan(dz, dx) - rat->Pose.Orientation.y;
+
+		if (TestSwarmPlayerContact(rat->Pose.Position, 85))
+		{
+			LaraItem->HitPoints--;
+			LaraItem->HitStatus = true;
+		}
+
+		// if life is even
+		if (rat->Flags & 1)
+		{
+			// if rat is very near
+			if (abs(dz) + abs(dx) <= SECTOR(1))
+			{
+				if (rat->Velocity & 1)
+					rat->Pose.Orientation.y += ANGLE(2.8f);
+				else
+					rat->Pose.Orientation.y -= ANGLE(2.8f);
+				rat->Velocity = 48 - (abs(angle) / ANGLE(5.6f));
+			}
+			else
+			{
+				if (rat->Velocity < (i & 31) + 24)
+					rat->Velocity++;
 
-				// if life is even
-				if (rat->Flags & 1)
+				if (abs(angle) >= ANGLE(11.25f))
 				{
-					// if rat is very near
-					if (abs(dz) + abs(dx) <= SECTOR(1))
-					{
-						if (rat->Velocity & 1)
-							rat->Pose.Orientation.y += ANGLE(2.8f);
-						else
-							rat->Pose.Orientation.y -= ANGLE(2.8f);
-						rat->Velocity = 48 - (abs(angle) / ANGLE(5.6f));
-					}
+					if (angle >= 0)
+						rat->Pose.Orientation.y += ANGLE(5.6f);
 					else
-					{
-						if (rat->Velocity < (i & 31) + 24)
-							rat->Velocity++;
-
-						if (abs(angle) >= ANGLE(11.25f))
-						{
-							if (angle >= 0)
-								rat->Pose.Orientation.y += ANGLE(5.6f);
-							else
-								rat->Pose.Orientation.y -= ANGLE(5.6f);
-						}
-						else
-							rat->Pose.Orientation.y += 8 * (Wibble - i);
-					}
+						rat->Pose.Orientation.y -= ANGLE(5.6f);
 				}
+				else
+					rat->Pose.Orientation.y += 8 * (Wibble - i);
+			}
+		}
 
-				short oldRoomNumber = rat->RoomNumber;
+		RatProbes.Add(i, rat->Pose.Position, oldPos, rat->RoomNumber, angle);
+	}
 
-				FloorInfo* floor = GetFloor(rat->Pose.Position.x, rat->Pose.Position.y, rat->Pose.Position.z,&rat->RoomNumber);
-				int height = GetFloorHeight(floor, rat->Pose.Position.x, rat->Pose.Position.y, rat->Pose.Position.z);
+	RatProbes.Resolve();
 
-				// if height is higher than 5 clicks 
-				if (height < rat->Pose.Position.y - 1280 ||
-					height == NO_HEIGHT)
+	for (const auto& probe : RatProbes.GetProbes())
+	{
+		int i = probe.AgentIndex;
+		auto* rat = &Rats[i];
+
+		short oldRoomNumber = rat->RoomNumber;
+		rat->RoomNumber = probe.RoomNumber;
+
+		int height = probe.FloorHeight;
+
+		// if height is higher than 5 clicks 
+		if (height < rat->Pose.Position.y - 1280 ||
+			height == NO_HEIGHT)
+		{
+			// if timer is higher than 170 time to disappear 
+			if (rat->Flags > 170)
+			{
+				rat->On = 0;
+				NextRat = 0;
+			}
+
+			if (probe.Angle <= 0)
+				rat->Pose.Orientation.y -= ANGLE(90.0f);
+			else
+				rat->Pose.Orientation.y += ANGLE(90.0f);
+
+			// reset rat to old Poseition and disable fall
+			rat->Pose.Position = probe.PrevPosition;
+			rat->VerticalVelocity = 0;
+		}
+		else
+		{
+			// if height is lower than Y + 64
+			if (height >= rat->Pose.Position.y - 64)
+			{
+				// if rat is higher than floor
+				if (height >= rat->Pose.Position.y)
 				{
-					// if timer is higher than 170 time to disappear 
-					if (rat->Flags > 170)
+					// if VerticalVelocity is too much or life is ended then kill rat
+					if (rat->VerticalVelocity >= 500 ||
+						rat->Flags >= 200)
 					{
 						rat->On = 0;
 						NextRat = 0;
 					}
-
-					if (angle <= 0)
-						rat->Pose.Orientation.y -= ANGLE(90.0f);
 					else
-						rat->Pose.Orientation.y += ANGLE(90.0f);
-
-					// reset rat to old Poseition and disable fall
-					rat->Pose.Position.x = oldX;
-					rat->Pose.Position.y = oldY;
-					rat->Pose.Position.z = oldZ;
-					rat->VerticalVelocity = 0;
+						rat->Pose.Orientation.x = -128 * rat->VerticalVelocity;
 				}
 				else
 				{
-					// if height is lower than Y + 64
-					if (height >= rat->Pose.Position.y - 64)
-					{
-						// if rat is higher than floor
-						if (height >= rat->Pose.Position.y)
-						{
-							// if VerticalVelocity is too much or life is ended then kill rat
-							if (rat->VerticalVelocity >= 500 ||
-								rat->Flags >= 200)
-							{
-								rat->On = 0;
-								NextRat = 0;
-							}
-							else
-								rat->Pose.Orientation.x = -128 * rat->VerticalVelocity;
-						}
-						else
-						{
-							rat->Pose.Position.y = height;
-							rat->VerticalVelocity = 0;
-							rat->Flags |= 1;
-						}
-					}
-					else
-					{
-						// if block is higher than rat Poseition then run vertically
-						rat->Pose.Orientation.x = ANGLE(78.75f);
-						rat->Pose.Position.x = oldX;
-						rat->Pose.Position.y = oldY - 24;
-						rat->Pose.Position.z = oldZ;
-						rat->VerticalVelocity = 0;
-					}
+					rat->Pose.Position.y = height;
+					rat->VerticalVelocity = 0;
+					rat->Flags |= 1;
 				}
+			}
+			else
+			{
+				// if block is higher than rat Poseition then run vertically
+				rat->Pose.Orientation.x = ANGLE(78.75f);
+				rat->Pose.Position.x = probe.PrevPosition.x;
+				rat->Pose.Position.y = probe.PrevPosition.y - 24;
+				rat->Pose.Position.z = probe.PrevPosition.z;
+				rat->VerticalVelocity = 0;
+			}
+		}
 
-				if (!(Wibble & 60))
-					rat->Flags += 2;
-
-				auto* room = &g_Level.Rooms[rat->RoomNumber];
+		if (!(Wibble & 60))
+			rat->Flags += 2;
 
-				if (TestEnvironment(ENV_FLAG_WATER, room))
-				{
-					rat->Pose.Position.y = room->maxceiling + 50;
-					rat->Velocity = 16;
-					rat->VerticalVelocity = 0;
+		auto* room = &g_Level.Rooms[rat->RoomNumber];
 
-					if (TestEnvironment(ENV_FLAG_WATER, oldRoomNumber))
-					{
-						if (!(GetRandomControl() & 0xF))
-							SpawnRipple(
-								Vector3(rat->Pose.Position.x, room->maxceiling, rat->Pose.Position.z),
-								rat->RoomNumber,
-								Random::GenerateFloat(48.0f, 52.0f),
-								(int)RippleFlags::SlowFade);
-					}
-					else
-					{
-						AddWaterSparks(rat->Pose.Position.x, room->maxceiling, rat->Pose.Position.z, 16);
-						SpawnRipple(
-							Vector3(rat->Pose.Position.x, room->maxceiling, rat->Pose.Position.z),
-							rat->RoomNumber,
-							Random::GenerateFloat(48.0f, 52.0f),
-							(int)RippleFlags::SlowFade);
-						
-						SoundEffect(SFX_TR5_RATS_SPLASH,&rat->Pose);
-					}
-				}
+		if (TestEnvironment(ENV_FLAG_WATER, room))
+		{
+			rat->Pose.Position.y = room->maxceiling + 50;
+			rat->Velocity = 16;
+			rat->VerticalVelocity = 0;
 
-				if (!i && !(GetRandomControl() & 4))
-					SoundEffect(SFX_TR5_RATS,&rat->Pose);
+			if (TestEnvironment(ENV_FLAG_WATER, oldRoomNumber))
+			{
+				if (!(GetRandomControl() & 0xF))
+					SpawnRipple(
+						Vector3(rat->Pose.Position.x, room->maxceiling, rat->Pose.Position.z),
+						rat->RoomNumber,
+						Random::GenerateFloat(48.0f, 52.0f),
+						(int)RippleFlags::SlowFade);
+			}
+			else
+			{
+				AddWaterSparks(rat->Pose.Position.x, room->maxceiling, rat->Pose.Position.z, 16);
+				SpawnRipple(
+					Vector3(rat->Pose.Position.x, room->maxceiling, rat->Pose.Position.z),
+					rat->RoomNumber,
+					Random::GenerateFloat(48.0f, 52.0f),
+					(int)RippleFlags::SlowFade);
+				
+				SoundEffect(SFX_TR5_RATS_SPLASH,&rat->Pose);
 			}
 		}
+
+		if (!i && !(GetRandomControl() & 4))
+			SoundEffect(SFX_TR5_RATS,&rat->Pose);
 	}
 }
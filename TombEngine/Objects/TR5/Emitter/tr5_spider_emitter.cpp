@@ -9,35 +9,18 @@
 #include "Sound/sound.h"
 #include "Game/Lara/lara.h"
 #include "Game/items.h"
+#include "Objects/Utils/SwarmHelpers.h"
+
+using namespace TEN::Entities::Swarm;
 
 int NextSpider;
 SpiderData Spiders[NUM_SPIDERS];
 
+static SwarmProbeBatch SpiderProbes = {};
+
 short GetNextSpider()
 {
-	short spiderNumber = NextSpider;
-	auto* spider = &Spiders[NextSpider];
-
-	int i = 0;
-	while (spider->On)
-	{
-		if (spiderNumber == (NUM_SPIDERS - 1))
-		{
-			spider = &Spiders[0];
-			spiderNumber = 0;
-		}
-		else
-		{
-			++spiderNumber;
-			++spider;
-		}
-
-		if (++i >= NUM_SPIDERS)
-			return NO_ITEM;
-	}
-
-	NextSpider = (spiderNumber + 1) & (NUM_SPIDERS - 1);
-	return spiderNumber;
+	return GetFreeSwarmAgent(Spiders, NextSpider, [](const SpiderData& spider) { return spider.On; });
 }
 
 void ClearSpiders()
@@ -125,122 +108,128 @@ void SpidersEmitterControl(short itemNumber)
 
 void UpdateSpiders()
 {
-	if (Objects[ID_SPIDERS_EMITTER].loaded)
+	if (!Objects[ID_SPIDERS_EMITTER].loaded)
+		return;
+
+	SpiderProbes.Clear();
+
+	for (int i = 0; i < NUM_SPIDERS; i++)
 	{
-		for (int i = 0; i < NUM_SPIDERS; i++)
-		{
-			auto* spider = &Spiders[i];
+		auto* spider = &Spiders[i];
 
-			if (spider->On)
-			{
-				int x = spider->Pose.Position.x;
-				int y = spider->Pose.Position.y;
-				int z = spider->Pose.Position.z;
+		if (!spider->On)
+			continue;
 
-				spider->Pose.Position.x += spider->Velocity * phd_sin(spider->Pose.Orientation.y);
-				spider->Pose.Position.y += spider->VerticalVelocity;
-				spider->Pose.Position.z += spider->Velocity * phd_cos(spider->Pose.Orientation.y);
-				spider->VerticalVelocity += GRAVITY;
+		auto oldPos = spider->Pose.Position;
 
-				int dx = LaraItem->Pose.Position.x - spider->Pose.Position.x;
-				int dy = LaraItem->Pose.Position.y - spider->Pose.Position.y;
-				int dz = LaraItem->Pose.Position.z - spider->Pose.Position.z;
+		spider->Pose.Position.x += spider->Velocity * phd_sin(spider->Pose.Orientation.y);
+		spider->Pose.Position.y += spider->VerticalVelocity;
+		spider->Pose.Position.z += spider->Velocity * phd_cos(spider->Pose.Orientation.y);
+		spider->VerticalVelocity += GRAVITY;
 
-				short angle = phd_atan(dz, dx) - spider->Pose.Orientation.y;
+		int dx = LaraItem->Pose.Position.x - spider->Pose.Position.x;
+		int dz = LaraItem->Pose.Position.z - spider->Pose.Position.z;
 
-				if (abs(dx) < 85 && abs(dy) < 85 && abs(dz) < 85)
-				{
-					DoDamage(LaraItem, 3);
-					TriggerBlood(spider->Pose.Position.x, spider->Pose.Position.y, spider->Pose.Position.z, spider->Pose.Orientation.y, 1);
-				}
+		short angle = phd_atan(dz, dx) - spider->Pose.Orientation.y;
 
-				if (spider->Flags)
-				{
-					if (abs(dx) + abs(dz) <= CLICK(3))
-					{
-						if (spider->Velocity & 1)
-							spider->Pose.Orientation.y += ANGLE(2.8f);
-						else
-							spider->Pose.Orientation.y -= ANGLE(2.8f);
+		if (TestSwarmPlayerContact(spider->Pose.Position, 85))
+		{
+			DoDamage(LaraItem, 3);
+			TriggerBlood(spider->Pose.Position.x, spider->Pose.Position.y, spider->Pose.Position.z, spider->Pose.Orientation.y, 1);
+		}
 
-						spider->Velocity = 48 - (abs(angle) / ANGLE(5.6f));
-					}
+		if (spider->Flags)
+		{
+			if (abs(dx) + abs(dz) <= CLICK(3))
+			{
+				if (spider->Velocity & 1)
+					spider->Pose.Orientation.y += ANGLE(2.8f);
+				else
+					spider->Pose.Orientation.y -= ANGLE(2.8f);
+
+				spider->Velocity = 48 - (abs(angle) / ANGLE(5.6f));
+			}
+			else
+			{
+				if (spider->Velocity < (i & 0x1F) + 24)
+					spider->Velocity++;
+
+				if (abs(angle) >= ANGLE(11.25f))
+				{
+					if (angle >= 0)
+						spider->Pose.Orientation.y += ANGLE(5.6f);
 					else
-					{
-						if (spider->Velocity < (i & 0x1F) + 24)
-							spider->Velocity++;
-
-						if (abs(angle) >= ANGLE(11.25f))
-						{
-							if (angle >= 0)
-								spider->Pose.Orientation.y += ANGLE(5.6f);
-							else
-								spider->Pose.Orientation.y -= ANGLE(5.6f);
-						}
-						else
-							spider->Pose.Orientation.y += 8 * (Wibble - i);
-					}
+						spider->Pose.Orientation.y -= ANGLE(5.6f);
 				}
+				else
+					spider->Pose.Orientation.y += 8 * (Wibble - i);
+			}
+		}
 
-				FloorInfo* floor = GetFloor(spider->Pose.Position.x, spider->Pose.Position.y, spider->Pose.Position.z,&spider->RoomNumber);
-				int height = GetFloorHeight(floor, spider->Pose.Position.x, spider->Pose.Position.y, spider->Pose.Position.z);
+		SpiderProbes.Add(i, spider->Pose.Position, oldPos, spider->RoomNumber, angle);
+	}
 
-				if (height >= spider->Pose.Position.y - CLICK(5) || height == -SECTOR(31.75f))
+	SpiderProbes.Resolve();
+
+	for (const auto& probe : SpiderProbes.GetProbes())
+	{
+		int i = probe.AgentIndex;
+		auto* spider = &Spiders[i];
+		spider->RoomNumber = probe.RoomNumber;
+
+		int height = probe.FloorHeight;
+		if (height >= spider->Pose.Position.y - CLICK(5) || height == -SECTOR(31.75f))
+		{
+			if (height >= spider->Pose.Position.y - 64)
+			{
+				if (spider->Pose.Position.y <= height)
 				{
-					if (height >= spider->Pose.Position.y - 64)
+					if (spider->VerticalVelocity >= 500)
 					{
-						if (spider->Pose.Position.y <= height)
-						{
-							if (spider->VerticalVelocity >= 500)
-							{
-								spider->On = false;
-								NextSpider = 0;
-							}
-							else
-								spider->Pose.Orientation.x = -128 * spider->VerticalVelocity;
-						}
-						else
-						{
-							spider->Pose.Position.y = height;
-							spider->VerticalVelocity = 0;
-							spider->Flags = 1;
-						}
+						spider->On = false;
+						NextSpider = 0;
 					}
 					else
-					{
-						spider->Pose.Position.x = x;
-						spider->Pose.Position.y = y - 8;
-						spider->Pose.Position.z = z;
-						spider->Pose.Orientation.x = ANGLE(78.75f);
-						spider->VerticalVelocity = 0;
-
-						if (!(GetRandomControl() & 0x1F))
-							spider->Pose.Orientation.y += -ANGLE(180.0f);
-					}
+						spider->Pose.Orientation.x = -128 * spider->VerticalVelocity;
 				}
 				else
 				{
-					if (angle <= 0)
-						spider->Pose.Orientation.y -= ANGLE(90.0f);
-					else
-						spider->Pose.Orientation.y += ANGLE(90.0f);
-
-					spider->Pose.Position.x = x;
-					spider->Pose.Position.y = y;
-					spider->Pose.Position.z = z;
+					spider->Pose.Position.y = height;
 					spider->VerticalVelocity = 0;
+					spider->Flags = 1;
 				}
+			}
+			else
+			{
+				spider->Pose.Position.x = probe.PrevPosition.x;
+				spider->Pose.Position.y = probe.PrevPosition.y - 8;
+				spider->Pose.Position.z = probe.PrevPosition.z;
+				spider->Pose.Orientation.x = ANGLE(78.75f);
+				spider->VerticalVelocity = 0;
 
-				if (spider->Pose.Position.y < g_Level.Rooms[spider->RoomNumber].maxceiling + 50)
-				{
-					spider->Pose.Position.y = g_Level.Rooms[spider->RoomNumber].maxceiling + 50;
+				if (!(GetRandomControl() & 0x1F))
 					spider->Pose.Orientation.y += -ANGLE(180.0f);
-					spider->VerticalVelocity = 1;
-				}
-
-				if (!i && !(GetRandomControl() & 4))
-					SoundEffect(SFX_TR5_INSECTS,&spider->Pose);
 			}
 		}
+		else
+		{
+			if (probe.Angle <= 0)
+				spider->Pose.Orientation.y -= ANGLE(90.0f);
+			else
+				spider->Pose.Orientation.y += ANGLE(90.0f);
+
+			spider->Pose.Position = probe.PrevPosition;
+			spider->VerticalVelocity = 0;
+		}
+
+		if (spider->Pose.Position.y < g_Level.Rooms[spider->RoomNumber].maxceiling + 50)
+		{
+			spider->Pose.Position.y = g_Level.Rooms[spider->RoomNumber].maxceiling + 50;
+			spider->Pose.Orientation.y += -ANGLE(180.0f);
+			spider->VerticalVelocity = 1;
+		}
+
+		if (!i && !(GetRandomControl() & 4))
+			SoundEffect(SFX_TR5_INSECTS,&spider->Pose);
 	}
 }
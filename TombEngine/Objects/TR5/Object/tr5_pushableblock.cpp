@@ -1,6 +1,8 @@
 #include "framework.h"
 #include "Objects/TR5/Object/tr5_pushableblock.h"
 
+#include <unordered_map>
+
 #include "Game/animation.h"
 #include "Game/items.h"
 #include "Game/collision/collide_item.h"
@@ -24,6 +26,12 @@ namespace TEN::Entities::Generic
 	constexpr auto PUSHABLE_FALL_RUMBLE_VELOCITY = 96.0f;
 
 	static auto PushableBlockPos = Vector3i::Zero;
+
+	// Index of settled pushables by world sector column, so stack lookups don't scan all level items.
+	// Pushables leave index while being pushed or falling and rejoin it once settled.
+	// Pushables moved or removed by other code (scripts, other objects) must be re-keyed with UpdatePushableStackIndex().
+	static std::unordered_map<long long, std::vector<int>> PushableColumns	 = {};
+	static std::unordered_map<int, long long>			   PushableColumnKeys = {};
 	ObjectCollisionBounds PushableBlockBounds = 
 	{
 		GameBoundingBox(
@@ -93,6 +101,7 @@ namespace TEN::Entities::Generic
 		pushable->height = height;
 
 		// Check for stack formation.
+		AddPushableToStackIndex(itemNumber);
 		FindStack(itemNumber);
 	}
 
@@ -180,6 +189,7 @@ namespace TEN::Entities::Generic
 				SoundEffect(pushable->fallSound, &item->Pose, SoundEnvironment::Always);
 
 				MoveStackY(itemNumber, relY);
+				AddPushableStackToStackIndex(itemNumber);
 				AddBridgeStack(itemNumber);
 
 				// If fallen on top of existing pushable, don't test triggers.
@@ -379,6 +389,7 @@ namespace TEN::Entities::Generic
 				item->Pose.Position.z = item->Pose.Position.z & 0xFFFFFE00 | 0x200;
 
 				MoveStackXZ(itemNumber);
+				AddPushableStackToStackIndex(itemNumber);
 				FindStack(itemNumber);
 				AddBridgeStack(itemNumber);
 
@@ -926,23 +937,121 @@ namespace TEN::Entities::Generic
 		}
 	}
 
-	void RemoveFromStack(short itemNumber) 
+	static long long GetStackIndexKey(const Vector3i& pos)
+	{
+		return (((long long)(pos.x / BLOCK(1)) << 32) | (unsigned int)(pos.z / BLOCK(1)));
+	}
+
+	static bool IsPushable(const ItemInfo& item)
 	{
-		// Unlink pushable from stack.
+		return (item.ObjectNumber >= ID_PUSHABLE_OBJECT1 && item.ObjectNumber <= ID_PUSHABLE_OBJECT10);
+	}
+
+	void ClearStackIndex()
+	{
+		PushableColumns.clear();
+		PushableColumnKeys.clear();
+	}
+
+	void RebuildStackIndex()
+	{
+		ClearStackIndex();
+
 		for (int i = 0; i < g_Level.NumItems; i++)
 		{
-			if (i == itemNumber)
-				continue;
+			if (IsPushable(g_Level.Items[i]))
+				AddPushableToStackIndex(i);
+		}
+	}
+
+	// Adds single pushable to column at its current position.
+	void AddPushableToStackIndex(short itemNumber)
+	{
+		RemovePushableFromStackIndex(itemNumber);
+
+		long long key = GetStackIndexKey(g_Level.Items[itemNumber].Pose.Position);
+		PushableColumns[key].push_back(itemNumber);
+		PushableColumnKeys[itemNumber] = key;
+	}
+
+	// Removes single pushable from its recorded column.
+	void RemovePushableFromStackIndex(short itemNumber)
+	{
+		auto keyIt = PushableColumnKeys.find(itemNumber);
+		if (keyIt == PushableColumnKeys.end())
+			return;
+
+		auto columnIt = PushableColumns.find(keyIt->second);
+		if (columnIt != PushableColumns.end())
+		{
+			auto& column = columnIt->second;
+			column.erase(std::remove(column.begin(), column.end(), itemNumber), column.end());
+
+			if (column.empty())
+				PushableColumns.erase(columnIt);
+		}
+
+		PushableColumnKeys.erase(keyIt);
+	}
 
-			auto& itemBelow = g_Level.Items[i];
+	// Adds pushable and all pushables stacked on top of it.
+	void AddPushableStackToStackIndex(short itemNumber)
+	{
+		for (int stackIndex = itemNumber; stackIndex != NO_ITEM; stackIndex = g_Level.Items[stackIndex].ItemFlags[1])
+			AddPushableToStackIndex(stackIndex);
+	}
+
+	// Removes pushable and all pushables stacked on top of it.
+	void RemovePushableStackFromStackIndex(short itemNumber)
+	{
+		for (int stackIndex = itemNumber; stackIndex != NO_ITEM; stackIndex = g_Level.Items[stackIndex].ItemFlags[1])
+			RemovePushableFromStackIndex(stackIndex);
+	}
+
+	// Re-keys indexed pushable after its position was changed by other code, or drops it if it's no longer pushable.
+	void UpdatePushableStackIndex(short itemNumber)
+	{
+		auto keyIt = PushableColumnKeys.find(itemNumber);
+		if (keyIt == PushableColumnKeys.end())
+			return;
+
+		const auto& item = g_Level.Items[itemNumber];
+		if (!IsPushable(item))
+			RemovePushableFromStackIndex(itemNumber);
+		else if (keyIt->second != GetStackIndexKey(item.Pose.Position))
+			AddPushableToStackIndex(itemNumber);
+	}
+
+	static const std::vector<int>* GetStackIndexColumn(const Vector3i& pos)
+	{
+		auto columnIt = PushableColumns.find(GetStackIndexKey(pos));
+		if (columnIt == PushableColumns.end())
+			return nullptr;
+
+		return &columnIt->second;
+	}
+
+	void RemoveFromStack(short itemNumber) 
+	{
+		const auto& item = g_Level.Items[itemNumber];
 
-			int objectNumber = itemBelow.ObjectNumber;
-			if (objectNumber >= ID_PUSHABLE_OBJECT1 && objectNumber <= ID_PUSHABLE_OBJECT10)
+		// Unlink pushable from stack. Pushable below can only be in same column.
+		const auto* column = GetStackIndexColumn(item.Pose.Position);
+		if (column != nullptr)
+		{
+			for (int i : *column)
 			{
-				if (itemBelow.ItemFlags[1] == itemNumber)
+				if (i == itemNumber)
+					continue;
+
+				auto& itemBelow = g_Level.Items[i];
+				if (IsPushable(itemBelow) && itemBelow.ItemFlags[1] == itemNumber)
 					itemBelow.ItemFlags[1] = NO_ITEM;
 			}
 		}
+
+		// Pushable and pushables stacked on it are about to move.
+		RemovePushableStackFromStackIndex(itemNumber);
 	}
 
 	int FindStack(short itemNumber)
@@ -950,31 +1059,32 @@ namespace TEN::Entities::Generic
 		int stackTop = NO_ITEM;		// Index of heighest pushable in stack.
 		int stackYmin = CLICK(256); // Set starting height.
 
+		const auto* item = &g_Level.Items[itemNumber];
+		auto pos = item->Pose.Position;
+
 		// Check for pushable directly below current one.
-		for (int i = 0; i < g_Level.NumItems; i++)
+		const auto* column = GetStackIndexColumn(pos);
+		if (column == nullptr)
+			return NO_ITEM;
+
+		for (int i : *column)
 		{
 			if (i == itemNumber)
 				continue;
 
 			auto* itemBelow = &g_Level.Items[i];
+			if (!IsPushable(*itemBelow))
+				continue;
 
-			int objectNumber = itemBelow->ObjectNumber;
-			if (objectNumber >= ID_PUSHABLE_OBJECT1 && objectNumber <= ID_PUSHABLE_OBJECT10)
+			if (itemBelow->Pose.Position.x == pos.x &&
+				itemBelow->Pose.Position.z == pos.z)
 			{
-				const auto* item = &g_Level.Items[itemNumber];
-
-				auto pos = item->Pose.Position;
-
-				if (itemBelow->Pose.Position.x == pos.x &&
-					itemBelow->Pose.Position.z == pos.z)
+				// Set heighest pushable so far as top of stack.
+				int belowY = itemBelow->Pose.Position.y;
+				if (belowY > pos.y && belowY < stackYmin)
 				{
-					// Set heighest pushable so far as top of stack.
-					int belowY = itemBelow->Pose.Position.y;
-					if (belowY > pos.y && belowY < stackYmin)
-					{
-						stackTop = i;
-						stackYmin = itemBelow->Pose.Position.y;
-					}
+					stackTop = i;
+					stackYmin = itemBelow->Pose.Position.y;
 				}
 			}
 		}
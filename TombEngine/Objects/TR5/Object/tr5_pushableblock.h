@@ -28,6 +28,15 @@ namespace TEN::Entities::Generic
 	int GetStackHeight(ItemInfo* item);
 	bool CheckStackLimit(ItemInfo* item);
 
+	// Pushable stack index
+	void ClearStackIndex();
+	void RebuildStackIndex();
+	void AddPushableToStackIndex(short itemNumber);
+	void RemovePushableFromStackIndex(short itemNumber);
+	void AddPushableStackToStackIndex(short itemNumber);
+	void RemovePushableStackFromStackIndex(short itemNumber);
+	void UpdatePushableStackIndex(short itemNumber);
+
 	void PushLoop(ItemInfo* item);
 	void PushEnd(ItemInfo* item);
 
@@ -0,0 +1,58 @@
+#include "framework.h"
+#include "Objects/Utils/SwarmHelpers.h"
+
+#include <execution>
+
+#include "Game/collision/collide_room.h"
+#include "Game/items.h"
+#include "Game/Lara/lara.h"
+
+namespace TEN::Entities::Swarm
+{
+	const std::vector<SwarmProbe>& SwarmProbeBatch::GetProbes() const
+	{
+		return Probes;
+	}
+
+	void SwarmProbeBatch::Clear()
+	{
+		Probes.clear();
+	}
+
+	void SwarmProbeBatch::Add(int agentIndex, const Vector3i& pos, const Vector3i& prevPos, short roomNumber, short angle)
+	{
+		auto probe = SwarmProbe{};
+		probe.AgentIndex = agentIndex;
+		probe.Position = pos;
+		probe.PrevPosition = prevPos;
+		probe.RoomNumber = roomNumber;
+		probe.Angle = angle;
+		Probes.push_back(probe);
+	}
+
+	void SwarmProbeBatch::Resolve()
+	{
+		auto resolveProbe = [](SwarmProbe& probe)
+		{
+			auto* floor = GetFloor(probe.Position.x, probe.Position.y, probe.Position.z, &probe.RoomNumber);
+			probe.FloorHeight = GetFloorHeight(floor, probe.Position.x, probe.Position.y, probe.Position.z);
+		};
+
+		if (Probes.size() >= PARALLEL_PROBE_COUNT_MIN)
+		{
+			std::for_each(std::execution::par, Probes.begin(), Probes.end(), resolveProbe);
+		}
+		else
+		{
+			for (auto& probe : Probes)
+				resolveProbe(probe);
+		}
+	}
+
+	bool TestSwarmPlayerContact(const Vector3i& pos, int range)
+	{
+		return (abs(LaraItem->Pose.Position.x - pos.x) < range &&
+				abs(LaraItem->Pose.Position.y - pos.y) < range &&
+				abs(LaraItem->Pose.Position.z - pos.z) < range);
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Game/items.h"
+#include "Math/Math.h"
+
+// Shared swarm agent handling.
+// Crawling swarms update in three passes: agents are moved and steered first, then floor probes of all
+// moved agents are resolved as one batch, and finally each agent reacts to its probe result.
+// Floor probes only read level geometry, so large batches are resolved in parallel.
+
+namespace TEN::Entities::Swarm
+{
+	struct SwarmProbe
+	{
+		int		 AgentIndex	  = 0;
+		Vector3i Position	  = Vector3i::Zero;
+		Vector3i PrevPosition = Vector3i::Zero;
+		short	 RoomNumber	  = 0;
+		short	 Angle		  = 0; // Heading to player relative to agent.
+
+		int FloorHeight = 0; // Set by SwarmProbeBatch::Resolve().
+	};
+
+	class SwarmProbeBatch
+	{
+	private:
+		// Constants
+		static constexpr auto PARALLEL_PROBE_COUNT_MIN = 64;
+
+		// Members
+		std::vector<SwarmProbe> Probes = {};
+
+	public:
+		// Getters
+		const std::vector<SwarmProbe>& GetProbes() const;
+
+		// Utilities
+		void Clear();
+		void Add(int agentIndex, const Vector3i& pos, const Vector3i& prevPos, short roomNumber, short angle);
+		void Resolve();
+	};
+
+	// Returns index of free agent in ring order starting at nextIndex, or NO_ITEM if swarm is full.
+	template <typename TAgent, int SIZE, typename TIsActive>
+	short GetFreeSwarmAgent(TAgent (&agents)[SIZE], int& nextIndex, TIsActive isActive)
+	{
+		int agentIndex = nextIndex;
+		for (int i = 0; i < SIZE; i++)
+		{
+			if (!isActive(agents[agentIndex]))
+			{
+				nextIndex = (agentIndex + 1) % SIZE;
+				return agentIndex;
+			}
+
+			agentIndex = (agentIndex + 1) % SIZE;
+		}
+
+		return NO_ITEM;
+	}
+
+	bool TestSwarmPlayerContact(const Vector3i& pos, int range);
+}
@@ -89,6 +89,17 @@ bool Frustum::SphereInFrustum(const Vector3& position, float radius) const
 	return true;
 }
 
+bool Frustum::SphereFullyInFrustum(const Vector3& position, float radius) const
+{
+	for (uint32_t i = 0; i < 6; i++)
+	{
+		if (m_frustum[i][0] * position.x + m_frustum[i][1] * position.y + m_frustum[i][2] * position.z + m_frustum[i][3] < radius)
+			return false;
+	}
+
+	return true;
+}
+
 bool Frustum::AABBInFrustum(const Vector3& min, const Vector3& max) const
 {
 	for (uint32_t i = 0; i < 6; i++)
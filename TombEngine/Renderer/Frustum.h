@@ -9,6 +9,7 @@ public:
 	void Update(const Matrix& view, const Matrix& projection);
 	bool PointInFrustum(const Vector3& position) const;
 	bool SphereInFrustum(const Vector3& position, float radius) const;
+	bool SphereFullyInFrustum(const Vector3& position, float radius) const;
 	bool AABBInFrustum(const Vector3& min, const Vector3& max) const;
 
 private:
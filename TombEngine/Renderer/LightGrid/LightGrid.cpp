@@ -0,0 +1,96 @@
+#include "framework.h"
+#include "Renderer/LightGrid/LightGrid.h"
+
+namespace TEN::Renderer
+{
+	void LightGrid::Build(const std::vector<RendererLight>& lights)
+	{
+		Entries.clear();
+		UnboundedLights.clear();
+
+		for (int i = 0; i < lights.size(); i++)
+		{
+			const auto& light = lights[i];
+
+			int minX = GetCellCoord(light.Position.x - light.Out);
+			int minY = GetCellCoord(light.Position.y - light.Out);
+			int minZ = GetCellCoord(light.Position.z - light.Out);
+			int maxX = GetCellCoord(light.Position.x + light.Out);
+			int maxY = GetCellCoord(light.Position.y + light.Out);
+			int maxZ = GetCellCoord(light.Position.z + light.Out);
+
+			int cellCount = (maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1);
+			if (cellCount > CELL_COUNT_PER_LIGHT_MAX)
+			{
+				UnboundedLights.push_back(i);
+				continue;
+			}
+
+			for (int x = minX; x <= maxX; x++)
+			{
+				for (int y = minY; y <= maxY; y++)
+				{
+					for (int z = minZ; z <= maxZ; z++)
+						Entries.push_back(Entry{ GetCellKey(x, y, z), i });
+				}
+			}
+		}
+
+		std::sort(
+			Entries.begin(), Entries.end(),
+			[](const Entry& entry0, const Entry& entry1)
+			{
+				if (entry0.CellKey == entry1.CellKey)
+					return (entry0.LightIndex < entry1.LightIndex);
+
+				return (entry0.CellKey < entry1.CellKey);
+			});
+	}
+
+	void LightGrid::Query(const Vector3& pos, float radius, std::vector<int>& lightIndices) const
+	{
+		lightIndices.clear();
+
+		int minX = GetCellCoord(pos.x - radius);
+		int minY = GetCellCoord(pos.y - radius);
+		int minZ = GetCellCoord(pos.z - radius);
+		int maxX = GetCellCoord(pos.x + radius);
+		int maxY = GetCellCoord(pos.y + radius);
+		int maxZ = GetCellCoord(pos.z + radius);
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int y = minY; y <= maxY; y++)
+			{
+				for (int z = minZ; z <= maxZ; z++)
+				{
+					long long cellKey = GetCellKey(x, y, z);
+					auto it = std::lower_bound(
+						Entries.begin(), Entries.end(), cellKey,
+						[](const Entry& entry, long long key) { return (entry.CellKey < key); });
+
+					for (; it != Entries.end() && it->CellKey == cellKey; it++)
+						lightIndices.push_back(it->LightIndex);
+				}
+			}
+		}
+
+		lightIndices.insert(lightIndices.end(), UnboundedLights.begin(), UnboundedLights.end());
+
+		// Light may overlap several queried cells. Return unique indices in light order.
+		std::sort(lightIndices.begin(), lightIndices.end());
+		lightIndices.erase(std::unique(lightIndices.begin(), lightIndices.end()), lightIndices.end());
+	}
+
+	long long LightGrid::GetCellKey(int x, int y, int z) const
+	{
+		constexpr auto COORD_MASK = (1ll << 21) - 1;
+
+		return (((x & COORD_MASK) << 42) | ((y & COORD_MASK) << 21) | (z & COORD_MASK));
+	}
+
+	int LightGrid::GetCellCoord(float value) const
+	{
+		return (int)floor(value / CELL_SIZE);
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <SimpleMath.h>
+
+#include "Renderer/Structures/RendererLight.h"
+
+// Per-frame uniform grid over dynamic lights.
+// Each light is registered in every cell overlapped by bounding box of its radius. Queries return
+// light indices of cells overlapped by query box, so callers only test lights which may reach them.
+
+namespace TEN::Renderer
+{
+	using DirectX::SimpleMath::Vector3;
+
+	class LightGrid
+	{
+	private:
+		struct Entry
+		{
+			long long CellKey	 = 0;
+			int		  LightIndex = 0;
+		};
+
+		// Constants
+		static constexpr auto CELL_SIZE				   = 4096.0f;
+		static constexpr auto CELL_COUNT_PER_LIGHT_MAX = 64;
+
+		// Members
+		std::vector<Entry> Entries		   = {}; // Sorted by cell key, then light index.
+		std::vector<int>   UnboundedLights = {}; // Lights overlapping too many cells. Returned by every query.
+
+	public:
+		// Utilities
+		void Build(const std::vector<RendererLight>& lights);
+		void Query(const Vector3& pos, float radius, std::vector<int>& lightIndices) const;
+
+	private:
+		// Helpers
+		long long GetCellKey(int x, int y, int z) const;
+		int		  GetCellCoord(float value) const;
+	};
+}
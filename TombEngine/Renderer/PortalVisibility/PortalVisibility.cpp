@@ -0,0 +1,280 @@
+#include "framework.h"
+#include "Renderer/PortalVisibility/PortalVisibility.h"
+
+#include "Game/room.h"
+#include "Math/Math.h"
+
+namespace TEN::Renderer
+{
+	const std::vector<VisibleRoom>& PortalVisibility::GetVisibleRooms() const
+	{
+		return VisibleRooms;
+	}
+
+	unsigned int PortalVisibility::GetRoomVisitCount() const
+	{
+		return RoomVisitCount;
+	}
+
+	unsigned int PortalVisibility::GetPortalTestCount() const
+	{
+		return PortalTestCount;
+	}
+
+	unsigned int PortalVisibility::GetFacingTestCount() const
+	{
+		return FacingTestCount;
+	}
+
+	void PortalVisibility::SetRooms(const std::vector<PortalRoom>& rooms)
+	{
+		Rooms = rooms;
+		BuildDoorOffsets();
+		Invalidate();
+	}
+
+	void PortalVisibility::SwapRooms(int roomNumber0, int roomNumber1)
+	{
+		std::swap(Rooms[roomNumber0], Rooms[roomNumber1]);
+		BuildDoorOffsets();
+		Invalidate();
+	}
+
+	bool PortalVisibility::WasReused() const
+	{
+		return IsReused;
+	}
+
+	void PortalVisibility::Invalidate()
+	{
+		IsCacheValid = false;
+	}
+
+	bool PortalVisibility::Update(const Vector3& cameraPos, const Matrix& viewProjection, int cameraRoomNumber)
+	{
+		IsReused = TestCacheHit(cameraPos, viewProjection, cameraRoomNumber);
+		if (IsReused)
+			return false;
+
+		Traverse(cameraPos, viewProjection, cameraRoomNumber);
+
+		IsCacheValid = true;
+		CachedRoomNumber = cameraRoomNumber;
+		CachedCameraPosition = cameraPos;
+		CachedViewProjection = viewProjection;
+		return true;
+	}
+
+	void PortalVisibility::BuildDoorOffsets()
+	{
+		DoorOffsets.resize(Rooms.size());
+
+		int doorCount = 0;
+		for (int i = 0; i < Rooms.size(); i++)
+		{
+			DoorOffsets[i] = doorCount;
+			doorCount += (int)Rooms[i].Doors.size();
+		}
+
+		DoorStates.assign(doorCount, DoorState{});
+		RoomStates.assign(Rooms.size(), RoomState{});
+		TraversalID = 0;
+	}
+
+	bool PortalVisibility::TestCacheHit(const Vector3& cameraPos, const Matrix& viewProjection, int cameraRoomNumber) const
+	{
+		if (!IsCacheValid || cameraRoomNumber != CachedRoomNumber)
+			return false;
+
+		if (Vector3::DistanceSquared(cameraPos, CachedCameraPosition) > SQUARE(CAMERA_POSITION_TOLERANCE))
+			return false;
+
+		const float* elements = &viewProjection._11;
+		const float* cachedElements = &CachedViewProjection._11;
+		for (int i = 0; i < 16; i++)
+		{
+			float tolerance = VIEW_PROJECTION_TOLERANCE * std::max(1.0f, std::abs(cachedElements[i]));
+			if (std::abs(elements[i] - cachedElements[i]) > tolerance)
+				return false;
+		}
+
+		return true;
+	}
+
+	void PortalVisibility::Traverse(const Vector3& cameraPos, const Matrix& viewProjection, int cameraRoomNumber)
+	{
+		VisibleRooms.clear();
+		WorkStack.clear();
+		RoomVisitCount = 0;
+		PortalTestCount = 0;
+		FacingTestCount = 0;
+
+		if (cameraRoomNumber < 0 || cameraRoomNumber >= Rooms.size())
+			return;
+
+		// Advance traversal ID instead of clearing per-door and per-room state.
+		TraversalID++;
+		if (TraversalID == 0)
+		{
+			DoorStates.assign(DoorStates.size(), DoorState{});
+			RoomStates.assign(RoomStates.size(), RoomState{});
+			TraversalID = 1;
+		}
+
+		WorkStack.push_back(WorkItem{ NO_ROOM, cameraRoomNumber, Vector4(-1.0f, -1.0f, 1.0f, 1.0f), 0 });
+
+		while (!WorkStack.empty())
+		{
+			auto item = WorkStack.back();
+			WorkStack.pop_back();
+
+			auto& roomState = RoomStates[item.ToRoomNumber];
+			bool isVisited = (roomState.TraversalID == TraversalID);
+
+			// Failsafe for degenerate portal loops.
+			if (isVisited && item.Depth > SEARCH_DEPTH_MAX)
+			{
+				TENLog("Maximum room collection depth of " + std::to_string(SEARCH_DEPTH_MAX) +
+					   " was reached with room " + std::to_string(item.ToRoomNumber), LogLevel::Warning);
+				continue;
+			}
+
+			RoomVisitCount++;
+
+			if (!isVisited)
+			{
+				roomState.TraversalID = TraversalID;
+				roomState.VisibleRoomIndex = (int)VisibleRooms.size();
+
+				// NOTE: View port starts as full screen, so room scissor rectangles currently remain full screen.
+				VisibleRooms.push_back(VisibleRoom{ item.ToRoomNumber, Vector4(-1.0f, -1.0f, 1.0f, 1.0f) });
+			}
+
+			auto& viewPort = VisibleRooms[roomState.VisibleRoomIndex].ViewPort;
+			viewPort.x = std::min(viewPort.x, item.ViewPort.x);
+			viewPort.y = std::min(viewPort.y, item.ViewPort.y);
+			viewPort.z = std::max(viewPort.z, item.ViewPort.z);
+			viewPort.w = std::max(viewPort.w, item.ViewPort.w);
+
+			// Push doors in reverse to visit them in declaration order.
+			const auto& room = Rooms[item.ToRoomNumber];
+			for (int i = (int)room.Doors.size() - 1; i >= 0; i--)
+			{
+				const auto& door = room.Doors[i];
+				auto& doorState = DoorStates[DoorOffsets[item.ToRoomNumber] + i];
+
+				if (doorState.TraversalID != TraversalID)
+				{
+					doorState.TraversalID = TraversalID;
+					doorState.IsTransformed = false;
+
+					// IMPORTANT: Dot product of 0 would allow traversing door in both directions, potentially
+					// generating endless loops. It must be excluded.
+					auto cameraToDoor = cameraPos - Vector3(door.Vertices[0].x, door.Vertices[0].y, door.Vertices[0].z);
+					cameraToDoor.Normalize();
+					doorState.IsFacingCamera = (door.Normal.Dot(cameraToDoor) > 0.0f);
+					FacingTestCount++;
+				}
+
+				if (!doorState.IsFacingCamera || door.RoomNumber == item.FromRoomNumber)
+					continue;
+
+				auto clipPort = Vector4::Zero;
+				if (TestPortal(doorState, door, viewProjection, item.ViewPort, clipPort))
+					WorkStack.push_back(WorkItem{ item.ToRoomNumber, door.RoomNumber, clipPort, item.Depth + 1 });
+			}
+		}
+	}
+
+	bool PortalVisibility::TestPortal(DoorState& doorState, const PortalDoor& door, const Matrix& viewProjection, const Vector4& viewPort, Vector4& clipPort)
+	{
+		PortalTestCount++;
+
+		auto& points = doorState.ProjectedVertices;
+		if (!doorState.IsTransformed)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				points[i] = Vector4::Transform(door.Vertices[i], viewProjection);
+				if (points[i].w > 0.0f)
+				{
+					points[i].x *= 1.0f / points[i].w;
+					points[i].y *= 1.0f / points[i].w;
+				}
+			}
+
+			doorState.IsTransformed = true;
+		}
+
+		clipPort = Vector4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+		int zClipCount = 0;
+		for (const auto& point : points)
+		{
+			if (point.w > 0.0f)
+			{
+				clipPort.x = std::min(clipPort.x, point.x);
+				clipPort.y = std::min(clipPort.y, point.y);
+				clipPort.z = std::max(clipPort.z, point.x);
+				clipPort.w = std::max(clipPort.w, point.y);
+			}
+			else
+			{
+				zClipCount++;
+			}
+		}
+
+		if (zClipCount == 4)
+			return false;
+
+		// Portal crosses near plane; extend clip rectangle to screen edges crossed by clipped edges.
+		if (zClipCount > 0)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				const auto& a = points[i];
+				const auto& b = points[(i + 1) % 4];
+
+				if ((a.w > 0.0f) == (b.w > 0.0f))
+					continue;
+
+				if (a.x < 0.0f && b.x < 0.0f)
+				{
+					clipPort.x = -1.0f;
+				}
+				else if (a.x > 0.0f && b.x > 0.0f)
+				{
+					clipPort.z = 1.0f;
+				}
+				else
+				{
+					clipPort.x = -1.0f;
+					clipPort.z = 1.0f;
+				}
+
+				if (a.y < 0.0f && b.y < 0.0f)
+				{
+					clipPort.y = -1.0f;
+				}
+				else if (a.y > 0.0f && b.y > 0.0f)
+				{
+					clipPort.w = 1.0f;
+				}
+				else
+				{
+					clipPort.y = -1.0f;
+					clipPort.w = 1.0f;
+				}
+			}
+		}
+
+		if (clipPort.x > viewPort.z || clipPort.y > viewPort.w || clipPort.z < viewPort.x || clipPort.w < viewPort.y)
+			return false;
+
+		clipPort.x = std::max(clipPort.x, viewPort.x);
+		clipPort.y = std::max(clipPort.y, viewPort.y);
+		clipPort.z = std::min(clipPort.z, viewPort.z);
+		clipPort.w = std::min(clipPort.w, viewPort.w);
+		return true;
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <SimpleMath.h>
+
+// Portal visibility.
+// Finds rooms visible from camera room by walking room portals clipped against screen space portal rectangles.
+// Traversal uses explicit work stack in same depth-first order as former recursive walk.
+// Result is reused while camera room, position and view projection stay within tolerance.
+
+namespace TEN::Renderer
+{
+	using DirectX::SimpleMath::Matrix;
+	using DirectX::SimpleMath::Vector3;
+	using DirectX::SimpleMath::Vector4;
+
+	struct PortalDoor
+	{
+		int					   RoomNumber = 0;
+		Vector3				   Normal	  = Vector3::Zero;
+		std::array<Vector4, 4> Vertices	  = {}; // World space.
+	};
+
+	struct PortalRoom
+	{
+		std::vector<PortalDoor> Doors = {};
+	};
+
+	struct VisibleRoom
+	{
+		int		RoomNumber = 0;
+		Vector4 ViewPort   = Vector4::Zero; // Normalized device coordinates.
+	};
+
+	class PortalVisibility
+	{
+	private:
+		struct DoorState
+		{
+			unsigned int		   TraversalID		 = 0; // State is valid only if equal to current traversal.
+			bool				   IsFacingCamera	 = false;
+			bool				   IsTransformed	 = false;
+			std::array<Vector4, 4> ProjectedVertices = {};
+		};
+
+		struct RoomState
+		{
+			unsigned int TraversalID	  = 0;
+			int			 VisibleRoomIndex = 0;
+		};
+
+		struct WorkItem
+		{
+			int		FromRoomNumber = 0;
+			int		ToRoomNumber   = 0;
+			Vector4 ViewPort	   = Vector4::Zero;
+			int		Depth		   = 0;
+		};
+
+		// Constants
+		static constexpr auto SEARCH_DEPTH_MAX			= 64;
+		static constexpr auto VIEW_PROJECTION_TOLERANCE = 0.0001f; // Relative to element magnitude.
+		static constexpr auto CAMERA_POSITION_TOLERANCE = 1.0f;
+
+		// Members
+		std::vector<PortalRoom>	 Rooms			= {};
+		std::vector<int>		 DoorOffsets	= {}; // First door state index per room.
+		std::vector<DoorState>	 DoorStates		= {};
+		std::vector<RoomState>	 RoomStates		= {};
+		std::vector<WorkItem>	 WorkStack		= {};
+		std::vector<VisibleRoom> VisibleRooms	= {};
+		unsigned int			 TraversalID	= 0;
+
+		bool	IsCacheValid		 = false;
+		int		CachedRoomNumber	 = 0;
+		Vector3 CachedCameraPosition = Vector3::Zero;
+		Matrix	CachedViewProjection = Matrix::Identity;
+
+		bool		 IsReused		 = false;
+		unsigned int RoomVisitCount	 = 0;
+		unsigned int PortalTestCount = 0;
+		unsigned int FacingTestCount = 0;
+
+	public:
+		// Getters
+		const std::vector<VisibleRoom>& GetVisibleRooms() const;
+		unsigned int GetRoomVisitCount() const;
+		unsigned int GetPortalTestCount() const;
+		unsigned int GetFacingTestCount() const;
+
+		// Setters
+		void SetRooms(const std::vector<PortalRoom>& rooms);
+		void SwapRooms(int roomNumber0, int roomNumber1);
+
+		// Inquirers
+		bool WasReused() const;
+
+		// Utilities
+		void Invalidate();
+		bool Update(const Vector3& cameraPos, const Matrix& viewProjection, int cameraRoomNumber);
+
+	private:
+		// Helpers
+		void BuildDoorOffsets();
+		bool TestCacheHit(const Vector3& cameraPos, const Matrix& viewProjection, int cameraRoomNumber) const;
+		void Traverse(const Vector3& cameraPos, const Matrix& viewProjection, int cameraRoomNumber);
+		bool TestPortal(DoorState& doorState, const PortalDoor& door, const Matrix& viewProjection, const Vector4& viewPort, Vector4& clipPort);
+	};
+}
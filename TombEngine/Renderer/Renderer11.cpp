@@ -69,21 +69,8 @@ namespace TEN::Renderer
 
 	int Renderer11::Synchronize()
 	{
-		// Sync the renderer
-		int nf = Sync();
-		if (nf < 2)
-		{
-			int i = 2 - nf;
-			nf = 2;
-			do
-			{
-				while (!Sync());
-				i--;
-			}
-			while (i);
-		}
-
-		return nf;
+		// Sleep until at least one game frame has passed since last call.
+		return g_FramePacer.WaitForTicks(SYNC_TICK_RATE / FPS);
 	}
 
 	void Renderer11::UpdateProgress(float value)
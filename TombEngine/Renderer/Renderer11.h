@@ -38,6 +38,9 @@
 #include "Specific/fast_vector.h"
 #include "Renderer/TextureBase.h"
 #include "Renderer/Texture2DArray/Texture2DArray.h"
+#include "Renderer/LightGrid/LightGrid.h"
+#include "Renderer/PortalVisibility/PortalVisibility.h"
+#include "Renderer/TextLayout/TextLayoutCache.h"
 #include "Renderer/ConstantBuffers/InstancedSpriteBuffer.h"
 #include "Renderer/ConstantBuffers/PostProcessBuffer.h"
 #include "Renderer/Structures/RendererBone.h"
@@ -373,6 +376,7 @@ namespace TEN::Renderer
 		std::shared_ptr<SpriteFont> m_gameFont;
 		std::shared_ptr<SpriteFont> m_techFont;
 		std::vector<RendererStringToDraw> m_strings;
+		TextLayoutCache m_textLayoutCache;
 		int m_blinkColorValue;
 		int m_blinkColorDirection;
 		bool m_blinkUpdated = false;
@@ -410,6 +414,9 @@ namespace TEN::Renderer
 		bool m_invalidateCache;
 
 		std::vector<RendererLight> m_dynamicLights;
+		LightGrid m_lightGrid;
+		std::vector<int> m_lightGridIndices;
+		std::vector<RendererLight*> m_collectedLights;
 		RendererLight* m_shadowLight;
 
 		std::vector<RendererLine3D> m_lines3DToDraw;
@@ -451,7 +458,6 @@ namespace TEN::Renderer
 		int m_numRoomsTransparentPolygons;
 		int m_numPolygons = 0;
 		int m_currentY;
-		int m_dotProducts = 0;
 
 		RENDERER_DEBUG_PAGE m_numDebugPage = NO_PAGE;
 
@@ -478,8 +484,11 @@ namespace TEN::Renderer
 
 		float m_farView = DEFAULT_FAR_VIEW;
 
-		int m_numCheckPortalCalls;
-		int m_numGetVisibleRoomsCalls;
+		// Frame interpolation state, valid during single Render() call
+		bool  m_interpolateFrame   = false;
+		float m_interpolationAlpha = 1.0f;
+
+		PortalVisibility m_portalVisibility;
 
 		// Private functions
 		void BindTexture(TEXTURE_REGISTERS registerType, TextureBase* texture, SAMPLER_STATES samplerType);
@@ -494,10 +503,9 @@ namespace TEN::Renderer
 		void BuildHierarchy(RendererObject* obj);
 		void BuildHierarchyRecursive(RendererObject* obj, RendererBone* node, RendererBone* parentNode);
 		void UpdateAnimation(RendererItem* item, RendererObject& obj, const AnimFrameInterpData& frameData, int mask, bool useObjectWorldRotation = false);
-		bool CheckPortal(short parentRoomNumber, RendererDoor* door, Vector4 viewPort, Vector4* clipPort, RenderView& renderView);
-		void GetVisibleRooms(short from, short to, Vector4 viewPort, bool water, int count, bool onlyRooms, RenderView& renderView);
 		void CollectRooms(RenderView& renderView, bool onlyRooms);
 		void CollectItems(short roomNumber, RenderView& renderView);
+		bool TestItemInFrustum(const ItemInfo& item, const Frustum& frustum);
 		void CollectStatics(short roomNumber, RenderView& renderView);
 		void CollectLights(Vector3 position, float radius, int roomNumber, int prevRoomNumber, bool prioritizeShadowLight, bool useCachedRoomLights, std::vector<RendererLight*>* roomsLights, std::vector<RendererLight*>* outputLights);
 		void CollectLightsForItem(RendererItem* item);
@@ -510,6 +518,8 @@ namespace TEN::Renderer
 		void ClearDynamicLights();
 		void ClearShadowMap();
 		void UpdateItemAnimations(RenderView& view);
+		void PrepareFrameInterpolation();
+		AnimFrameInterpData GetItemFrameInterpData(const ItemInfo& item);
 		bool PrintDebugMessage(int x, int y, int alpha, byte r, byte g, byte b, LPCSTR Message);
 
 		void InitialiseScreen(int w, int h, HWND handle, bool reset);
@@ -598,10 +608,10 @@ namespace TEN::Renderer
 		void SetCullMode(CULL_MODES cullMode, bool force = false);
 		void SetAlphaTest(ALPHA_TEST_MODES mode, float threshold, bool force = false);
 		void SetScissor(RendererRectangle rectangle);
-		void ResetAnimations();
 		void ResetScissor();
 		void ResetDebugVariables();
 		float CalculateFrameRate();
+		Matrix GetItemLogicWorldMatrix(const ItemInfo& item) const;
 
 		void AddSpriteBillboard(RendererSprite* sprite, const Vector3& pos, const Vector4& color, float orient2D, float scale,
 		                        Vector2 size, BLEND_MODES blendMode, bool isSoftParticle, RenderView& view);
@@ -721,6 +731,7 @@ namespace TEN::Renderer
 		void FlipRooms(short roomNumber1, short roomNumber2);
 		void UpdateLaraAnimations(bool force);
 		void UpdateItemAnimations(int itemNumber, bool force);
+		void ResetAnimations();
 		int  GetSpheres(short itemNumber, BoundingSphere* ptr, char worldSpace, Matrix local);
 		void GetBoneMatrix(short itemNumber, int jointIndex, Matrix* outMatrix);
 		void DrawObjectIn2DSpace(int objectNumber, Vector2 pos2D, EulerAngles orient, float scale1, float opacity = 1.0f, int meshBits = NO_JOINT_BITS);
@@ -408,6 +408,22 @@ namespace TEN::Renderer
 				}
 			}
 		}
+
+		auto portalRooms = std::vector<PortalRoom>(m_rooms.size());
+		for (int i = 0; i < m_rooms.size(); i++)
+		{
+			for (const auto& door : m_rooms[i].Doors)
+			{
+				auto portalDoor = PortalDoor{};
+				portalDoor.RoomNumber = door.RoomNumber;
+				portalDoor.Normal = door.Normal;
+				std::copy(std::begin(door.AbsoluteVertices), std::end(door.AbsoluteVertices), portalDoor.Vertices.begin());
+				portalRooms[i].Doors.push_back(portalDoor);
+			}
+		}
+
+		m_portalVisibility.SetRooms(portalRooms);
+
 		m_roomsVertexBuffer = VertexBuffer(m_device.Get(), m_roomsVertices.size(), m_roomsVertices.data());
 		m_roomsIndexBuffer = IndexBuffer(m_device.Get(), m_roomsIndices.size(), m_roomsIndices.data());
 
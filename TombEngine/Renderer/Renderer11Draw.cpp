@@ -10,6 +10,7 @@
 #include "Game/camera.h"
 #include "Game/control/control.h"
 #include "Game/control/volume.h"
+#include "Game/debug/profiler.h"
 #include "Game/effects/Hair.h"
 #include "Game/effects/tomb4fx.h"
 #include "Game/effects/weather.h"
@@ -1408,19 +1409,19 @@ namespace TEN::Renderer
 
 		// Prepare the scene to draw
 		auto time1 = std::chrono::high_resolution_clock::now();
-		CollectRooms(view, false);
+		PROFILE_CALL(CollectRooms(view, false));
 		auto timeRoomsCollector = std::chrono::high_resolution_clock::now();
 		m_timeRoomsCollector = (std::chrono::duration_cast<ns>(timeRoomsCollector - time1)).count() / 1000000;
 		time1 = timeRoomsCollector;
 
-		UpdateLaraAnimations(false);
-		UpdateItemAnimations(view);
+		PROFILE_CALL(UpdateLaraAnimations(false));
+		PROFILE_CALL(UpdateItemAnimations(view));
 
 		m_stBlending.AlphaTest = -1;
 		m_stBlending.AlphaThreshold = -1;
 
-		CollectLightsForCamera();
-		RenderItemShadows(view);
+		PROFILE_CALL(CollectLightsForCamera());
+		PROFILE_CALL(RenderItemShadows(view));
 
 		auto time2 = std::chrono::high_resolution_clock::now();
 		m_timeUpdate = (std::chrono::duration_cast<ns>(time2 - time1)).count() / 1000000;
@@ -2306,9 +2307,20 @@ namespace TEN::Renderer
 	void Renderer11::Render()
 	{
 		//RenderToCubemap(m_reflectionCubemap, Vector3(LaraItem->pos.xPos, LaraItem->pos.yPos - 1024, LaraItem->pos.zPos), LaraItem->roomNumber);
+		PrepareFrameInterpolation();
 		RenderScene(m_backBufferRTV, m_depthStencilView, gameCamera);
+
+		// Game logic queries bone transforms from renderer, so drop interpolated joint transforms after frame.
+		// They are rebuilt from logic state on next query; player is rebuilt at once, as player draw paths reuse it.
+		if (m_interpolateFrame)
+		{
+			m_interpolateFrame = false;
+			ResetAnimations();
+			UpdateLaraAnimations(true);
+		}
+
 		m_context->ClearState();
-		m_swapChain->Present(1, 0);
+		PROFILE_CALL(m_swapChain->Present(1, 0));
 	}
 
 	void Renderer11::DrawMoveableMesh(RendererItem* itemToDraw, RendererMesh* mesh, RendererRoom* room, int boneIndex, bool transparent)
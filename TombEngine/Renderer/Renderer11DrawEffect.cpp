@@ -1378,122 +1378,96 @@ namespace TEN::Renderer
 	}
 
 	void Renderer11::DrawDebris(RenderView& view, bool transparent)
-	{		
-		m_context->VSSetShader(m_vsStatics.Get(), NULL, 0);
-		m_context->PSSetShader(m_psStatics.Get(), NULL, 0);
+	{
+		constexpr auto DEBRIS_DRAW_VERTEX_COUNT_MAX = 3 * 1024; // Must stay below primitive batch capacity.
 
 		extern std::vector<DebrisFragment> DebrisFragments;
-		std::vector<RendererVertex> vertices;
+		static auto debrisBatches = DebrisBatchBuilder{};
 
-		BLEND_MODES lastBlendMode = BLEND_MODES::BLENDMODE_UNSET;
+		debrisBatches.Build(DebrisFragments, transparent);
+		if (debrisBatches.GetBatches().empty())
+			return;
 
-		for (auto deb = DebrisFragments.begin(); deb != DebrisFragments.end(); deb++)
+		m_context->VSSetShader(m_vsStatics.Get(), NULL, 0);
+		m_context->PSSetShader(m_psStatics.Get(), NULL, 0);
+
+		SetCullMode(CULL_MODE_NONE);
+
+		if (transparent)
 		{
-			if (deb->active) 
-			{
-				if (!((deb->mesh.blendMode == BLENDMODE_OPAQUE || deb->mesh.blendMode == BLENDMODE_ALPHATEST) ^ transparent))
-					continue;
+			SetAlphaTest(ALPHA_TEST_NONE, 1.0f);
+		}
+		else
+		{
+			SetAlphaTest(ALPHA_TEST_GREATER_THAN, ALPHA_TEST_THRESHOLD);
+		}
 
-				Matrix translation = Matrix::CreateTranslation(deb->worldPosition.x, deb->worldPosition.y, deb->worldPosition.z);
-				Matrix rotation = Matrix::CreateFromQuaternion(deb->rotation);
-				Matrix world = rotation * translation;
+		// Fragment transforms and colors are baked into batch vertices.
+		m_stStatic.World = Matrix::Identity;
+		m_stStatic.Color = Vector4::One;
 
-				m_primitiveBatch->Begin();
+		const auto& vertices = debrisBatches.GetVertices();
+		for (const auto& batch : debrisBatches.GetBatches())
+		{
+			if (batch.IsStatic)
+			{
+				BindTexture(TEXTURE_COLOR_MAP, &std::get<0>(m_staticsTextures[batch.Texture]), SAMPLER_LINEAR_CLAMP);
+			}
+			else
+			{
+				BindTexture(TEXTURE_COLOR_MAP, &std::get<0>(m_moveablesTextures[batch.Texture]), SAMPLER_LINEAR_CLAMP);
+			}
 
-				if (deb->isStatic) 
-				{
-					BindTexture(TEXTURE_COLOR_MAP, &std::get<0>(m_staticsTextures[deb->mesh.tex]), SAMPLER_LINEAR_CLAMP);
-				} 
-				else 
-				{
-					BindTexture(TEXTURE_COLOR_MAP, &std::get<0>(m_moveablesTextures[deb->mesh.tex]), SAMPLER_LINEAR_CLAMP);
-				}
+			SetBlendMode(batch.BlendMode);
 
-				if (transparent)
-				{
-					SetAlphaTest(ALPHA_TEST_NONE, 1.0f);
-				}
-				else
-				{
-					SetAlphaTest(ALPHA_TEST_GREATER_THAN, ALPHA_TEST_THRESHOLD);
-				}
+			m_stStatic.AmbientLight = m_rooms[batch.RoomNumber].AmbientLight;
+			m_stStatic.LightMode = batch.LightMode;
+			m_cbStatic.updateData(m_stStatic, m_context.Get());
+			BindConstantBufferVS(CB_STATIC, m_cbStatic.get());
 
-				m_stStatic.World = world;
-				m_stStatic.Color = deb->color;
-				m_stStatic.AmbientLight = m_rooms[deb->roomNumber].AmbientLight;
-				m_stStatic.LightMode = deb->lightMode;
-
-				m_cbStatic.updateData(m_stStatic, m_context.Get());
-				BindConstantBufferVS(CB_STATIC, m_cbStatic.get());
-
-				RendererVertex vtx0;
-				vtx0.Position = deb->mesh.Positions[0];
-				vtx0.UV = deb->mesh.TextureCoordinates[0];
-				vtx0.Normal = deb->mesh.Normals[0];
-				vtx0.Color = deb->mesh.Colors[0];
-
-				RendererVertex vtx1;
-				vtx1.Position = deb->mesh.Positions[1];
-				vtx1.UV = deb->mesh.TextureCoordinates[1];
-				vtx1.Normal = deb->mesh.Normals[1];
-				vtx1.Color = deb->mesh.Colors[1];
-
-				RendererVertex vtx2;
-				vtx2.Position = deb->mesh.Positions[2];
-				vtx2.UV = deb->mesh.TextureCoordinates[2];
-				vtx2.Normal = deb->mesh.Normals[2];
-				vtx2.Color = deb->mesh.Colors[2];
-
-				if (lastBlendMode != deb->mesh.blendMode)
-				{
-					lastBlendMode = deb->mesh.blendMode;
-					SetBlendMode(lastBlendMode);
-				}
+			m_primitiveBatch->Begin();
 
-				SetCullMode(CULL_MODE_NONE);
-				m_primitiveBatch->DrawTriangle(vtx0, vtx1, vtx2);
+			for (unsigned int i = 0; i < batch.VertexCount; i += DEBRIS_DRAW_VERTEX_COUNT_MAX)
+			{
+				unsigned int vertexCount = std::min(batch.VertexCount - i, (unsigned int)DEBRIS_DRAW_VERTEX_COUNT_MAX);
+				m_primitiveBatch->Draw(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, &vertices[batch.VertexStart + i], vertexCount);
 				m_numDrawCalls++;
-				m_primitiveBatch->End();
 			}
+
+			m_primitiveBatch->End();
 		}
 	}
 
 	void Renderer11::DrawSmokeParticles(RenderView& view)
 	{
 		using TEN::Effects::Smoke::SmokeParticles;
-		using TEN::Effects::Smoke::SmokeParticle;
 
-		for (const auto& smoke : SmokeParticles) 
+		for (int i = 0; i < SmokeParticles.Count; i++)
 		{
-			if (!smoke.active)
-				continue;
+			const auto& data = SmokeParticles.Extras[i];
 
 			AddSpriteBillboard(
-				&m_sprites[Objects[ID_SMOKE_SPRITES].meshIndex + smoke.sprite],
-				smoke.position,
-				smoke.color, smoke.rotation, 1.0f, { smoke.size, smoke.size }, BLENDMODE_ALPHABLEND, true, view);
+				&m_sprites[Objects[ID_SMOKE_SPRITES].meshIndex + data.Sprite],
+				SmokeParticles.Positions.Get(i),
+				SmokeParticles.Colors.Get(i), data.Rotation, 1.0f, { data.Size, data.Size }, BLENDMODE_ALPHABLEND, true, view);
 		}
 	}
 
 	void Renderer11::DrawSparkParticles(RenderView& view)
 	{
-		using TEN::Effects::Spark::SparkParticle;
 		using TEN::Effects::Spark::SparkParticles;
 
-		extern std::array<SparkParticle, 128> SparkParticles;
-
-		for (int i = 0; i < SparkParticles.size(); i++) 
+		for (int i = 0; i < SparkParticles.Count; i++)
 		{
-			SparkParticle& s = SparkParticles[i];
-			if (!s.active) continue;
+			const auto& data = SparkParticles.Extras[i];
+
 			Vector3 v;
-			s.velocity.Normalize(v);
+			SparkParticles.Velocities.Get(i).Normalize(v);
 
-			float normalizedLife = s.age / s.life;
+			float normalizedLife = SparkParticles.GetNormalizedAge(i);
 			auto height = Lerp(1.0f, 0.0f, normalizedLife);
-			auto color = Vector4::Lerp(s.sourceColor, s.destinationColor, normalizedLife);
 
-			AddSpriteBillboardConstrained(&m_sprites[Objects[ID_SPARK_SPRITE].meshIndex], s.pos, color, 0, 1, { s.width, s.height * height }, BLENDMODE_ADDITIVE, -v, false, view);
+			AddSpriteBillboardConstrained(&m_sprites[Objects[ID_SPARK_SPRITE].meshIndex], SparkParticles.Positions.Get(i), SparkParticles.Colors.Get(i), 0, 1, { data.Width, data.Height * height }, BLENDMODE_ADDITIVE, -v, false, view);
 		}
 	}
 
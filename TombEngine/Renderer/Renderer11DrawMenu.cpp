@@ -3,19 +3,27 @@
 
 #include "Game/animation.h"
 #include "Game/control/control.h"
+#include "Game/control/scheduler.h"
+#include "Game/control/snapshot.h"
 #include "Game/control/volume.h"
+#include "Game/debug/profiler.h"
 #include "Game/Gui.h"
 #include "Game/Hud/Hud.h"
+#include "Game/items.h"
 #include "Game/Lara/lara.h"
 #include "Game/savegame.h"
 #include "Math/Math.h"
 #include "Scripting/Internal/TEN/Flow//Level/FlowLevel.h"
+#include "Specific/clock.h"
 #include "Specific/configuration.h"
 #include "Specific/level.h"
 #include "Specific/setup.h"
 #include "Specific/trutils.h"
 #include "Specific/winmain.h"
 
+using namespace TEN::Control::Scheduler;
+using namespace TEN::Control::Snapshot;
+using namespace TEN::Debug;
 using namespace TEN::Gui;
 using namespace TEN::Hud;
 using namespace TEN::Input;
@@ -49,6 +57,9 @@ namespace TEN::Renderer
 	constexpr auto MenuVerticalPause = 220;
 	constexpr auto MenuVerticalOptionsPause = 275;
 
+	// Debug page limits
+	constexpr auto DebugSchedulerItemLineCount = 16;
+
 	// Title logo positioning
 	constexpr auto LogoTop = 50;
 	constexpr auto LogoWidth = 300;
@@ -917,7 +928,15 @@ namespace TEN::Renderer
 				PrintDebugMessage("GPU: %s", g_Configuration.AdapterName.c_str());
 				PrintDebugMessage("Resolution: %d x %d", m_screenWidth, m_screenHeight);
 				PrintDebugMessage("Fps: %3.2f", m_fps);
+				{
+					auto frameMetrics = g_FramePacer.GetMetrics();
+					PrintDebugMessage("Frame pacing: %.2f ms avg, %.2f ms jitter", frameMetrics.AverageMs, frameMetrics.JitterMs);
+					PrintDebugMessage("    min/max: %.2f / %.2f ms", frameMetrics.MinMs, frameMetrics.MaxMs);
+					PrintDebugMessage("    spin tail: %.2f ms, max oversleep: %.2f ms", frameMetrics.SpinTailMs, frameMetrics.MaxOversleepMs);
+				}
 				PrintDebugMessage("ControlPhase() time: %d", ControlPhaseTime);
+				PrintDebugMessage("Render snapshot: %.3f ms, %d items, alpha %.2f",
+					RenderSnapshots.GetBuildTime(), RenderSnapshots.GetCapturedItemCount(), m_interpolationAlpha);
 				PrintDebugMessage("Rooms collector time: %d", m_timeRoomsCollector);
 				PrintDebugMessage("Update time: %d", m_timeUpdate);
 				PrintDebugMessage("Frame time: %d", m_timeFrame);
@@ -936,9 +955,10 @@ namespace TEN::Renderer
 				PrintDebugMessage("Biggest room's index buffer: %d", m_biggestRoomIndexBuffer);
 				PrintDebugMessage("Total rooms transparent polygons: %d", m_numRoomsTransparentPolygons);
 				PrintDebugMessage("Rooms: %d", view.roomsToDraw.size());
-				PrintDebugMessage("    CheckPortal() calls: %d", m_numCheckPortalCalls);
-				PrintDebugMessage("    GetVisibleRooms() calls: %d", m_numGetVisibleRoomsCalls);
-				PrintDebugMessage("    dot products: %d", m_dotProducts);
+				PrintDebugMessage("    Visibility reused: %s", m_portalVisibility.WasReused() ? "yes" : "no");
+				PrintDebugMessage("    Room visits: %d", m_portalVisibility.GetRoomVisitCount());
+				PrintDebugMessage("    Portal tests: %d", m_portalVisibility.GetPortalTestCount());
+				PrintDebugMessage("    Facing tests: %d", m_portalVisibility.GetFacingTestCount());
 
 				break;
 
@@ -975,6 +995,51 @@ namespace TEN::Renderer
 				PrintDebugMessage("Move axis horizontal: %f", AxisMap[InputAxis::MoveHorizontal]);
 				PrintDebugMessage("Look axis vertical: %f", AxisMap[InputAxis::CameraVertical]);
 				PrintDebugMessage("Look axis horizontal: %f", AxisMap[InputAxis::CameraHorizontal]);
+#ifdef TEN_PROFILER
+				if (const auto* frame = g_Profiler.GetFrame(0))
+				{
+					PrintDebugMessage("Profiled frame: %.3f ms, %d scopes, %d dropped", frame->GetDuration(), (int)frame->Events.size(), frame->DroppedEventCount);
+
+					const auto* event = frame->GetSlowestObjectEvent();
+					if (event != nullptr)
+					{
+						PrintDebugMessage("    slowest object: %s #%d (%s), %.3f ms", GetObjectName((GAME_OBJECT_ID)event->ObjectID).c_str(),
+							event->Index, event->Name, (event->EndTime - event->StartTime) / 1000000.0f);
+					}
+				}
+				PrintDebugMessage("    F9: export trace to %s", PROFILER_TRACE_PATH);
+#endif
+				break;
+
+			case RENDERER_DEBUG_PAGE::SCHEDULER_STATS:
+				PrintDebugMessage("Updated items: %d, skipped: %d", g_ItemScheduler.GetTickCount(), g_ItemScheduler.GetSkipCount());
+				PrintDebugMessage("High: %d, medium: %d, low: %d, sleeping: %d",
+					(int)g_ItemScheduler.GetBucket(TickPriority::High).size(), (int)g_ItemScheduler.GetBucket(TickPriority::Medium).size(),
+					(int)g_ItemScheduler.GetBucket(TickPriority::Low).size(), (int)g_ItemScheduler.GetBucket(TickPriority::Sleep).size());
+
+				// List items with reduced tick rate first.
+				for (int i = (int)TickPriority::Sleep, lineCount = 0; i >= (int)TickPriority::High; i--)
+				{
+					auto priority = (TickPriority)i;
+					unsigned int interval = ItemScheduler::GetTickInterval(priority);
+
+					for (int itemNumber : g_ItemScheduler.GetBucket(priority))
+					{
+						if (lineCount++ >= DebugSchedulerItemLineCount)
+							break;
+
+						const auto& item = g_Level.Items[itemNumber];
+						if (interval == 0)
+						{
+							PrintDebugMessage("    %s #%d: sleeping", GetObjectName(item.ObjectNumber).c_str(), itemNumber);
+						}
+						else
+						{
+							PrintDebugMessage("    %s #%d: every %d frame(s)", GetObjectName(item.ObjectNumber).c_str(), itemNumber, interval);
+						}
+					}
+				}
+
 				break;
 
 			default:
@@ -119,6 +119,7 @@ enum RENDERER_DEBUG_PAGE
 	DIMENSION_STATS,
 	LARA_STATS,
 	LOGIC_STATS,
+	SCHEDULER_STATS,
 	WIREFRAME_MODE
 };
 
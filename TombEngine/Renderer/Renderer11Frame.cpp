@@ -5,6 +5,7 @@
 #include "Game/animation.h"
 #include "Game/camera.h"
 #include "Game/collision/sphere.h"
+#include "Game/control/snapshot.h"
 #include "Game/effects/effects.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
@@ -14,6 +15,7 @@
 #include "Specific/setup.h"
 #include "RenderView/RenderView.h"
 
+using namespace TEN::Control::Snapshot;
 using namespace TEN::Math;
 
 namespace TEN::Renderer
@@ -35,17 +37,31 @@ namespace TEN::Renderer
 			room->LightsToDraw.clear();
 			room->Visited = false;
 			room->ViewPort = Vector4(-1.0f, -1.0f, 1.0f, 1.0f);
+		}
+
+		m_lightGrid.Build(m_dynamicLights);
+
+		auto cameraPos = Vector3(Camera.pos.x, Camera.pos.y, Camera.pos.z);
+		m_portalVisibility.Update(cameraPos, renderView.camera.ViewProjection, renderView.camera.RoomNumber);
+
+		for (const auto& visibleRoom : m_portalVisibility.GetVisibleRooms())
+		{
+			RendererRoom* room = &m_rooms[visibleRoom.RoomNumber];
+
+			room->Visited = true;
+			room->ViewPort = visibleRoom.ViewPort;
+			renderView.roomsToDraw.push_back(room);
+
+			CollectLightsForRoom(visibleRoom.RoomNumber, renderView);
 
-			for (int j = 0; j < room->Doors.size(); j++)
+			if (!onlyRooms)
 			{
-				room->Doors[j].Visited = false;
-				room->Doors[j].InvisibleFromCamera = false;
-				room->Doors[j].DotProduct = FLT_MAX;
+				CollectItems(visibleRoom.RoomNumber, renderView);
+				CollectStatics(visibleRoom.RoomNumber, renderView);
+				CollectEffects(visibleRoom.RoomNumber);
 			}
 		}
 
-		GetVisibleRooms(NO_ROOM, renderView.camera.RoomNumber, Vector4(-1.0f, -1.0f, 1.0f, 1.0f), false, 0, onlyRooms, renderView);
-
 		m_invalidateCache = false;
 
 		// Prepae the real DX scissor test rectangle
@@ -64,200 +80,6 @@ namespace TEN::Renderer
 			});
 	}
 
-	bool Renderer11::CheckPortal(short parentRoomNumber, RendererDoor* door, Vector4 viewPort, Vector4* clipPort, RenderView& renderView)
-	{
-		m_numCheckPortalCalls++;
-
-		RendererRoom* room = &m_rooms[parentRoomNumber];
-		ROOM_INFO* nativeRoom = &g_Level.Rooms[parentRoomNumber];
-
-		int  zClip = 0;
-		Vector4 p[4];
-
-		*clipPort = Vector4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-		for (int i = 0; i < 4; i++)
-		{
-			if (!door->Visited)
-			{
-				p[i] = Vector4::Transform(door->AbsoluteVertices[i], renderView.camera.ViewProjection);
-				if (p[i].w > 0.0f)
-				{
-					p[i].x *= (1.0f / p[i].w);
-					p[i].y *= (1.0f / p[i].w);
-
-				}
-				door->TransformedVertices[i] = p[i];
-			}
-			else
-			{
-				p[i] = door->TransformedVertices[i];
-			}
-
-			if (p[i].w > 0.0f)
-			{
-				clipPort->x = std::min(clipPort->x, p[i].x);
-				clipPort->y = std::min(clipPort->y, p[i].y);
-				clipPort->z = std::max(clipPort->z, p[i].x);
-				clipPort->w = std::max(clipPort->w, p[i].y);
-			}
-			else
-			{
-				zClip++;
-			}
-		}
-
-		door->Visited = true;
-
-		if (zClip == 4)
-		{
-			return false;
-		}
-
-		if (zClip > 0)
-		{
-			for (int i = 0; i < 4; i++) 
-			{
-				Vector4 a = p[i];
-				Vector4 b = p[(i + 1) % 4];
-
-				if ((a.w > 0.0f) ^ (b.w > 0.0f))
-				{
-
-					if (a.x < 0.0f && b.x < 0.0f)
-					{
-						clipPort->x = -1.0f;
-					}
-					else
-					{
-						if (a.x > 0.0f && b.x > 0.0f)
-						{
-							clipPort->z = 1.0f;
-						}
-						else 
-						{
-							clipPort->x = -1.0f;
-							clipPort->z = 1.0f;
-						}
-					}
-
-					if (a.y < 0.0f && b.y < 0.0f)
-					{
-						clipPort->y = -1.0f;
-					}
-					else
-					{
-						if (a.y > 0.0f && b.y > 0.0f)
-						{
-							clipPort->w = 1.0f;
-						}
-						else 
-						{
-							clipPort->y = -1.0f;
-							clipPort->w = 1.0f;
-						}
-					}
-				}
-			}
-		}
-
-		if (clipPort->x > viewPort.z || clipPort->y > viewPort.w || clipPort->z < viewPort.x || clipPort->w < viewPort.y)
-		{
-			return false;
-		}
-
-		clipPort->x = std::max(clipPort->x, viewPort.x);
-		clipPort->y = std::max(clipPort->y, viewPort.y);
-		clipPort->z = std::min(clipPort->z, viewPort.z);
-		clipPort->w = std::min(clipPort->w, viewPort.w);
-
-		return true;
-	}
-
-	void Renderer11::GetVisibleRooms(short from, short to, Vector4 viewPort, bool water, int count, bool onlyRooms, RenderView& renderView)
-	{
-		// FIXME: This is an urgent hack to fix stack overflow crashes.
-		// See https://github.com/MontyTRC89/TombEngine/issues/947 for details.
-		// NOTE by MontyTRC: I'd keep this as a failsafe solution for 0.00000001% of cases we could have problems
-
-		static constexpr int MAX_SEARCH_DEPTH = 64;
-		if (m_rooms[to].Visited && count > MAX_SEARCH_DEPTH)
-		{
-			TENLog("Maximum room collection depth of " + std::to_string(MAX_SEARCH_DEPTH) + 
-				   " was reached with room " + std::to_string(to), LogLevel::Warning);
-			return;
-		}
-
-		m_numGetVisibleRoomsCalls++;
-
-		RendererRoom* room = &m_rooms[to];
-		ROOM_INFO* nativeRoom = &g_Level.Rooms[to];
-
-		if (!room->Visited)
-		{
-			room->Visited = true;
-
-			renderView.roomsToDraw.push_back(room);
-
-			CollectLightsForRoom(to, renderView);
-
-			if (!onlyRooms)
-			{
-				CollectItems(to, renderView);
-				CollectStatics(to, renderView);
-				CollectEffects(to);
-			}
-		}
-
-		room->ViewPort.x = std::min(room->ViewPort.x, viewPort.x);
-		room->ViewPort.y = std::min(room->ViewPort.y, viewPort.y);
-		room->ViewPort.z = std::max(room->ViewPort.z, viewPort.z);
-		room->ViewPort.w = std::max(room->ViewPort.w, viewPort.w);
-
-		Vector4 clipPort;
-		for (int i = 0; i < room->Doors.size(); i++)
-		{
-			RendererDoor* door = &room->Doors[i];
-
-			if (door->InvisibleFromCamera)
-			{
-				continue;
-			}
-
-			if (!door->Visited)
-			{
-				door->CameraToDoor = Vector3(
-					Camera.pos.x - (door->AbsoluteVertices[0].x),
-					Camera.pos.y - (door->AbsoluteVertices[0].y),
-					Camera.pos.z - (door->AbsoluteVertices[0].z));
-				door->CameraToDoor.Normalize();
-			}
-
-			// IMPORTANT: dot = 0 would generate ambiguity becase door could be traversed in both directions, potentially 
-			// generating endless loops. We need to exclude this.
-
-			if (door->DotProduct == FLT_MAX)
-			{
-				door->DotProduct = 
-					door->Normal.x * door->CameraToDoor.x +
-					door->Normal.y * door->CameraToDoor.y +
-					door->Normal.z * door->CameraToDoor.z;
-				m_dotProducts++;
-			}
-
-			if (door->DotProduct <= 0)
-			{
-				door->InvisibleFromCamera = true;
-				continue;
-			}
-
-			if (from != door->RoomNumber && CheckPortal(to, door, viewPort, &clipPort, renderView))
-			{
-				GetVisibleRooms(to, door->RoomNumber, clipPort, water, count + 1, onlyRooms, renderView);
-			}
-		}
-	}
-
 	void Renderer11::CollectItems(short roomNumber, RenderView& renderView)
 	{
 		if (m_rooms.size() < roomNumber)
@@ -308,21 +130,8 @@ namespace TEN::Renderer
 			// Clip object by frustum only if it doesn't cast shadows. Otherwise we may see
 			// disappearing shadows if object gets out of frustum.
 
-			if (obj.ShadowType == ShadowMode::None)
-			{
-				// Get all spheres and check if frustum intersects any of them.
-				static BoundingSphere spheres[MAX_BONES];
-				int cnt = GetSpheres(itemNum, spheres, SPHERES_SPACE_WORLD, Matrix::Identity);
-
-				bool inFrustum = false;
-				for (int i = 0; !inFrustum, i < cnt; i++)
-					// Blow up sphere radius by half for cases of too small calculated spheres.
-					if (renderView.camera.Frustum.SphereInFrustum(spheres[i].Center, spheres[i].Radius * 1.5f))
-						inFrustum = true;
-				
-				if (!inFrustum)
-					continue;
-			}
+			if (obj.ShadowType == ShadowMode::None && !TestItemInFrustum(*item, renderView.camera.Frustum))
+				continue;
 
 			auto newItem = &m_items[itemNum];
 
@@ -333,6 +142,14 @@ namespace TEN::Renderer
 			newItem->Translation = Matrix::CreateTranslation(item->Pose.Position.x, item->Pose.Position.y, item->Pose.Position.z);
 			newItem->Rotation = item->Pose.Orientation.ToRotationMatrix();
 			newItem->Scale = Matrix::CreateScale(1.0f);
+
+			auto orient = Quaternion::Identity;
+			if (m_interpolateFrame && RenderSnapshots.GetInterpolatedItemPose(itemNum, m_interpolationAlpha, newItem->Position, orient))
+			{
+				newItem->Translation = Matrix::CreateTranslation(newItem->Position);
+				newItem->Rotation = Matrix::CreateFromQuaternion(orient);
+			}
+
 			newItem->World = newItem->Rotation * newItem->Translation;
 
 			CalculateLightFades(newItem);
@@ -342,6 +159,45 @@ namespace TEN::Renderer
 		}
 	}
 
+	bool Renderer11::TestItemInFrustum(const ItemInfo& item, const Frustum& frustum)
+	{
+		// Blow up sphere radius by half for cases of too small calculated spheres.
+		constexpr auto SPHERE_RADIUS_MULT = 1.5f;
+
+		// Test sphere around current frame bounds first. Mutators may move meshes outside of frame bounds,
+		// and items without animations or bounds can't be tested, so such items are always tested per joint.
+		bool hasMutators = std::any_of(
+			item.Model.Mutators.begin(), item.Model.Mutators.end(),
+			[](const BoneMutator& mutator) { return !mutator.IsEmpty(); });
+
+		if (!hasMutators && Objects[item.ObjectNumber].animIndex != NO_ANIM)
+		{
+			auto sphere = GetBestFrame(item).BoundingBox.ToBoundingSphere(item.Pose);
+			if (sphere.Radius > 0.0f)
+			{
+				float radius = sphere.Radius * SPHERE_RADIUS_MULT;
+
+				if (!frustum.SphereInFrustum(sphere.Center, radius))
+					return false;
+
+				if (frustum.SphereFullyInFrustum(sphere.Center, radius))
+					return true;
+			}
+		}
+
+		// Item is partly visible; check if frustum intersects any joint sphere.
+		static BoundingSphere spheres[MAX_BONES];
+		int count = GetSpheres(item.Index, spheres, SPHERES_SPACE_WORLD, Matrix::Identity);
+
+		for (int i = 0; i < count; i++)
+		{
+			if (frustum.SphereInFrustum(spheres[i].Center, spheres[i].Radius * SPHERE_RADIUS_MULT))
+				return true;
+		}
+
+		return false;
+	}
+
 	void Renderer11::CollectStatics(short roomNumber, RenderView& renderView)
 	{
 		if (m_rooms.size() < roomNumber)
@@ -398,24 +254,22 @@ namespace TEN::Renderer
 			}
 			 
 			// Collect the lights
-			std::vector<RendererLight*> lights;
-			std::vector<RendererLight*> cachedRoomLights;
+			mesh->LightsToDraw.clear();
 			if (obj.ObjectMeshes.front()->LightMode != LIGHT_MODES::LIGHT_MODE_STATIC)
 			{
 				if (mesh->CacheLights || m_invalidateCache)
 				{
 					// Collect all lights and return also cached light for the next frames
-					CollectLights(mesh->Pose.Position.ToVector3(), ITEM_LIGHT_COLLECTION_RADIUS, room.RoomNumber, NO_ROOM, false, false, &cachedRoomLights, &lights);
+					mesh->CachedRoomLights.clear();
+					CollectLights(mesh->Pose.Position.ToVector3(), ITEM_LIGHT_COLLECTION_RADIUS, room.RoomNumber, NO_ROOM, false, false, &mesh->CachedRoomLights, &mesh->LightsToDraw);
 					mesh->CacheLights = false;
-					mesh->CachedRoomLights = cachedRoomLights;
 				}
 				else
 				{
 					// Collecy only dynamic lights and use cached lights from rooms
-					CollectLights(mesh->Pose.Position.ToVector3(), ITEM_LIGHT_COLLECTION_RADIUS, room.RoomNumber, NO_ROOM, false, true, &mesh->CachedRoomLights, &lights);
+					CollectLights(mesh->Pose.Position.ToVector3(), ITEM_LIGHT_COLLECTION_RADIUS, room.RoomNumber, NO_ROOM, false, true, &mesh->CachedRoomLights, &mesh->LightsToDraw);
 				}
 			}
-			mesh->LightsToDraw = lights;
 
 			// At this point, we are sure that we must draw the static mesh
 			room.StaticsToDraw.push_back(mesh);
@@ -437,18 +291,21 @@ namespace TEN::Renderer
 		}
 
 		// Now collect lights from dynamic list and from rooms
-		std::vector<RendererLight*> tempLights;
-		tempLights.reserve(MAX_LIGHTS_DRAW);
-		
+		auto& tempLights = m_collectedLights;
+		tempLights.clear();
+
 		RendererRoom& room = m_rooms[roomNumber];
 		ROOM_INFO* nativeRoom = &g_Level.Rooms[room.RoomNumber];
 
 		RendererLight* brightestLight = nullptr;
 		float brightest = 0.0f;
 
-		// Dynamic lights have the priority
-		for (auto& light : m_dynamicLights)
+		// Dynamic lights have the priority. Only those from grid cells near position are tested.
+		m_lightGrid.Query(position, radius, m_lightGridIndices);
+		for (int lightIndex : m_lightGridIndices)
 		{
+			auto& light = m_dynamicLights[lightIndex];
+
 			float distanceSquared =
 				SQUARE(position.x - light.Position.x) +
 				SQUARE(position.y - light.Position.y) +
@@ -596,12 +453,13 @@ namespace TEN::Renderer
 			}
 		}
 
-		// Sort lights by distance, if needed
-
+		// Sort nearest lights by distance, if needed. One extra light is sorted in case shadow light is skipped below.
 		if (tempLights.size() > MAX_LIGHTS_PER_ITEM)
 		{
-			std::sort(
+			int sortCount = std::min((int)tempLights.size(), MAX_LIGHTS_PER_ITEM + 1);
+			std::partial_sort(
 				tempLights.begin(),
+				tempLights.begin() + sortCount,
 				tempLights.end(),
 				[](RendererLight* a, RendererLight* b)
 				{
@@ -767,9 +625,17 @@ namespace TEN::Renderer
 			Matrix translation = Matrix::CreateTranslation(fx->pos.Position.x, fx->pos.Position.y, fx->pos.Position.z);
 			Matrix rotation = fx->pos.Orientation.ToRotationMatrix();
 
+			newEffect->Position = fx->pos.Position.ToVector3();
+
+			auto orient = Quaternion::Identity;
+			if (m_interpolateFrame && RenderSnapshots.GetInterpolatedEffectPose(fxNum, m_interpolationAlpha, newEffect->Position, orient))
+			{
+				translation = Matrix::CreateTranslation(newEffect->Position);
+				rotation = Matrix::CreateFromQuaternion(orient);
+			}
+
 			newEffect->ObjectNumber = fx->objectNumber;
 			newEffect->RoomNumber = fx->roomNumber;
-			newEffect->Position = fx->pos.Position.ToVector3();
 			newEffect->AmbientLight = room.AmbientLight;
 			newEffect->Color = fx->color;
 			newEffect->World = rotation * translation;
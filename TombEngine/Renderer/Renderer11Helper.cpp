@@ -7,6 +7,7 @@
 #include "Game/camera.h"
 #include "Game/collision/sphere.h"
 #include "Game/control/control.h"
+#include "Game/control/snapshot.h"
 #include "Game/itemdata/creature_info.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
@@ -25,10 +26,12 @@
 #include "Math/Math.h"
 #include "Renderer/RenderView/RenderView.h"
 #include "Renderer/Renderer11.h"
+#include "Specific/clock.h"
 #include "Specific/configuration.h"
 #include "Specific/level.h"
 #include "Specific/setup.h"
 
+using namespace TEN::Control::Snapshot;
 using namespace TEN::Math;
 
 extern GameConfiguration g_Configuration;
@@ -46,6 +49,25 @@ namespace TEN::Renderer
 
 		auto* transforms = ((rItem == nullptr) ? rObject.AnimationTransforms.data() : &rItem->AnimationTransforms[0]);
 
+		// Check nullptr, otherwise inventory crashes.
+		if (rObject.Skeleton == nullptr)
+			return;
+
+		// Blend local orientations of whole skeleton in one pass.
+		const auto& orients0 = frameData.FramePtr0->BoneOrientations;
+		int orientCount = std::min((int)orients0.size(), MAX_BONES);
+
+		Quaternion blendedOrients[MAX_BONES];
+		const Quaternion* localOrients = orients0.data();
+		if (frameData.Alpha != 0.0f)
+		{
+			const auto& orients1 = frameData.FramePtr1->BoneOrientations;
+			orientCount = std::min(orientCount, (int)orients1.size());
+
+			SlerpArray(orients0.data(), orients1.data(), frameData.Alpha, orientCount, blendedOrients);
+			localOrients = blendedOrients;
+		}
+
 		// Push.
 		bones[nextBone++] = rObject.Skeleton;
 
@@ -58,8 +80,7 @@ namespace TEN::Renderer
 			if (bonePtr == nullptr)
 				return;
 
-			if (frameData.FramePtr0->BoneOrientations.size() <= bonePtr->Index ||
-				(frameData.Alpha != 0.0f && frameData.FramePtr0->BoneOrientations.size() <= bonePtr->Index))
+			if (bonePtr->Index >= orientCount)
 			{
 				TENLog(
 					"Attempted to animate object with ID " + GetObjectName((GAME_OBJECT_ID)rItem->ObjectNumber) +
@@ -73,21 +94,10 @@ namespace TEN::Renderer
 			if (calculateMatrix)
 			{
 				auto offset0 = frameData.FramePtr0->Offset;
-				auto rotMatrix = Matrix::CreateFromQuaternion(frameData.FramePtr0->BoneOrientations[bonePtr->Index]);
-				
 				if (frameData.Alpha != 0.0f)
-				{
-					auto offset1 = frameData.FramePtr1->Offset;
-					offset0 = Vector3::Lerp(offset0, offset1, frameData.Alpha);
-
-					auto rotMatrix2 = Matrix::CreateFromQuaternion(frameData.FramePtr1->BoneOrientations[bonePtr->Index]);
+					offset0 = Vector3::Lerp(offset0, frameData.FramePtr1->Offset, frameData.Alpha);
 
-					auto quat1 = Quaternion::CreateFromRotationMatrix(rotMatrix);
-					auto quat2 = Quaternion::CreateFromRotationMatrix(rotMatrix2);
-					auto quat3 = Quaternion::Slerp(quat1, quat2, frameData.Alpha);
-
-					rotMatrix = Matrix::CreateFromQuaternion(quat3);
-				}
+				auto rotMatrix = Matrix::CreateFromQuaternion(localOrients[bonePtr->Index]);
 
 				auto tMatrix = (bonePtr == rObject.Skeleton) ? Matrix::CreateTranslation(offset0) : Matrix::Identity;
 
@@ -301,7 +311,8 @@ namespace TEN::Renderer
 				});
 		}
 
-		auto frameData = GetFrameInterpData(*nativeItem);
+		// Logic queries force update and must always get live pose.
+		auto frameData = force ? GetFrameInterpData(*nativeItem) : GetItemFrameInterpData(*nativeItem);
 		UpdateAnimation(itemToDraw, moveableObj, frameData, UINT_MAX);
 
 		for (int m = 0; m < obj->nmeshes; m++)
@@ -360,6 +371,43 @@ namespace TEN::Renderer
 		gameCamera = RenderView(cam, roll, fov, 32, farView, g_Configuration.Width, g_Configuration.Height);
 	}
 
+	void Renderer11::PrepareFrameInterpolation()
+	{
+		m_interpolateFrame = (g_Configuration.EnableFrameInterpolation && RenderSnapshots.CanInterpolate());
+		m_interpolationAlpha = 1.0f;
+
+		if (!m_interpolateFrame)
+			return;
+
+		m_interpolationAlpha = RenderSnapshots.GetAlpha(g_FramePacer.GetTime());
+
+		// Rebuild camera from interpolated snapshot state.
+		auto cameraSnapshot = RenderSnapshots.GetInterpolatedCamera(m_interpolationAlpha);
+
+		auto camera = Camera;
+		camera.pos = GameVector(Vector3i(cameraSnapshot.Position), cameraSnapshot.RoomNumber);
+		camera.target = GameVector(Vector3i(cameraSnapshot.Target), cameraSnapshot.RoomNumber);
+
+		UpdateCameraMatrices(&camera, cameraSnapshot.Roll, cameraSnapshot.Fov, cameraSnapshot.FarView);
+	}
+
+	Matrix Renderer11::GetItemLogicWorldMatrix(const ItemInfo& item) const
+	{
+		return (item.Pose.Orientation.ToRotationMatrix() * Matrix::CreateTranslation(item.Pose.Position.ToVector3()));
+	}
+
+	AnimFrameInterpData Renderer11::GetItemFrameInterpData(const ItemInfo& item)
+	{
+		if (m_interpolateFrame)
+		{
+			auto frameData = RenderSnapshots.GetInterpolatedFrameData(item.Index, m_interpolationAlpha);
+			if (frameData.FramePtr0 != nullptr)
+				return frameData;
+		}
+
+		return GetFrameInterpData(item);
+	}
+
 	bool Renderer11::SphereBoxIntersection(BoundingBox box, Vector3 sphereCentre, float sphereRadius)
 	{
 		if (sphereRadius == 0.0f)
@@ -380,6 +428,7 @@ namespace TEN::Renderer
 		m_rooms[roomNumber1].RoomNumber = roomNumber1;
 		m_rooms[roomNumber2].RoomNumber = roomNumber2;
 
+		m_portalVisibility.SwapRooms(roomNumber1, roomNumber2);
 		m_invalidateCache = true;
 	}
 
@@ -454,20 +503,23 @@ namespace TEN::Renderer
 
 	void Renderer11::GetBoneMatrix(short itemNumber, int jointIndex, Matrix* outMatrix)
 	{
+		// Joint queries serve game logic, so world matrix is built from logic pose, never from interpolated one.
 		if (itemNumber == Lara.ItemNumber)
 		{
+			if (!m_items[itemNumber].DoneAnimations)
+				UpdateLaraAnimations(false);
+
 			auto& object = *m_moveableObjects[ID_LARA];
-			*outMatrix = object.AnimationTransforms[jointIndex] * m_LaraWorldMatrix;
+			*outMatrix = object.AnimationTransforms[jointIndex] * GetItemLogicWorldMatrix(*LaraItem);
 		}
 		else
 		{
 			UpdateItemAnimations(itemNumber, true);
 			
-			auto* rendererItem = &m_items[itemNumber];
 			auto* nativeItem = &g_Level.Items[itemNumber];
 
 			auto& obj = *m_moveableObjects[nativeItem->ObjectNumber];
-			*outMatrix = obj.AnimationTransforms[jointIndex] * rendererItem->World;
+			*outMatrix = obj.AnimationTransforms[jointIndex] * GetItemLogicWorldMatrix(*nativeItem);
 		}
 	}
 
@@ -559,7 +611,7 @@ namespace TEN::Renderer
 		if (jointIndex >= MAX_BONES)
 			jointIndex = 0;
 
-		auto world = rendererItem->AnimationTransforms[jointIndex] * rendererItem->World;
+		auto world = rendererItem->AnimationTransforms[jointIndex] * GetItemLogicWorldMatrix(g_Level.Items[itemNumber]);
 		return Vector3::Transform(relOffset, world);
 	}
 }
@@ -131,6 +131,8 @@ void TEN::Renderer::Renderer11::Initialise(int w, int h, bool windowed, HWND han
 
 	// Preallocate lists
 	m_dynamicLights = createVector<RendererLight>(MAX_DYNAMIC_LIGHTS);
+	m_lightGridIndices = createVector<int>(MAX_DYNAMIC_LIGHTS);
+	m_collectedLights = createVector<RendererLight*>(MAX_LIGHTS_DRAW);
 	m_lines3DToDraw = createVector<RendererLine3D>(MAX_LINES_3D);
 	m_lines2DToDraw = createVector<RendererLine2D>(MAX_LINES_2D);
 	m_transparentFaces = createVector<RendererTransparentFace>(MAX_TRANSPARENT_FACES);
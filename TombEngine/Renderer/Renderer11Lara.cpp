@@ -7,6 +7,7 @@
 #include "Game/Lara/lara.h"
 #include "Game/Lara/lara_fire.h"
 #include "Game/control/control.h"
+#include "Game/control/snapshot.h"
 #include "Game/spotcam.h"
 #include "Game/camera.h"
 #include "Game/collision/sphere.h"
@@ -16,6 +17,7 @@
 #include "Specific/level.h"
 #include "Specific/setup.h"
 
+using namespace TEN::Control::Snapshot;
 using namespace TEN::Effects::Hair;
 using namespace TEN::Math;
 using namespace TEN::Renderer;
@@ -95,6 +97,14 @@ void Renderer11::UpdateLaraAnimations(bool force)
 	auto tMatrix = Matrix::CreateTranslation(LaraItem->Pose.Position.ToVector3());
 	auto rotMatrix = LaraItem->Pose.Orientation.ToRotationMatrix();
 
+	auto pos = Vector3::Zero;
+	auto orient = Quaternion::Identity;
+	if (m_interpolateFrame && RenderSnapshots.GetInterpolatedItemPose(LaraItem->Index, m_interpolationAlpha, pos, orient))
+	{
+		tMatrix = Matrix::CreateTranslation(pos);
+		rotMatrix = Matrix::CreateFromQuaternion(orient);
+	}
+
 	m_LaraWorldMatrix = rotMatrix * tMatrix;
 	rItem.World = m_LaraWorldMatrix;
 
@@ -105,7 +115,7 @@ void Renderer11::UpdateLaraAnimations(bool force)
 	// First calculate matrices for legs, hips, head, and torso.
 	int mask = MESH_BITS(LM_HIPS) | MESH_BITS(LM_LTHIGH) | MESH_BITS(LM_LSHIN) | MESH_BITS(LM_LFOOT) | MESH_BITS(LM_RTHIGH) | MESH_BITS(LM_RSHIN) | MESH_BITS(LM_RFOOT) | MESH_BITS(LM_TORSO) | MESH_BITS(LM_HEAD);
 	
-	auto frameData = GetFrameInterpData(*LaraItem);
+	auto frameData = GetItemFrameInterpData(*LaraItem);
 	UpdateAnimation(&rItem, playerObject, frameData, mask);
 
 	// Then the arms, based on current weapon status.
@@ -115,7 +125,7 @@ void Renderer11::UpdateLaraAnimations(bool force)
 	{
 		// Both arms
 		mask = MESH_BITS(LM_LINARM) | MESH_BITS(LM_LOUTARM) | MESH_BITS(LM_LHAND) | MESH_BITS(LM_RINARM) | MESH_BITS(LM_ROUTARM) | MESH_BITS(LM_RHAND);
-		auto frameData = GetFrameInterpData(*LaraItem);
+		auto frameData = GetItemFrameInterpData(*LaraItem);
 		UpdateAnimation(&rItem, playerObject, frameData, mask);
 	}
 	else
@@ -1,8 +1,6 @@
 #include "framework.h"
 #include "Renderer/Renderer11.h"
 
-#include "Specific/trutils.h"
-
 namespace TEN::Renderer
 {
 	void Renderer11::AddString(int x, int y, const char* string, D3DCOLOR color, int flags)
@@ -30,13 +28,17 @@ namespace TEN::Renderer
 			float fontSpacing = m_gameFont->GetLineSpacing();
 			float fontScale   = REFERENCE_FONT_SIZE / fontSpacing;
 
-			auto stringLines = SplitString(string);
+			// Split, convert and measure string only when it isn't cached yet.
+			const auto& layout = m_textLayoutCache.GetLayout(
+				string, m_gameFont.get(),
+				[this](const std::wstring& line) { return Vector2(m_gameFont->MeasureString(line.c_str())).x; });
+
 			float yOffset = 0.0f;
-			for (const auto& line : stringLines)
+			for (const auto& line : layout.Lines)
 			{
 				// Prepare structure for renderer.
 				RendererStringToDraw rString;
-				rString.String = TEN::Utils::ToWString(line);
+				rString.String = line.String;
 				rString.Flags = flags;
 				rString.X = 0;
 				rString.Y = 0;
@@ -44,9 +46,7 @@ namespace TEN::Renderer
 				rString.Scale = (UIScale * fontScale) * scale;
 				rString.Font = font;
 
-				// Measure string.
-				auto size = Vector2(m_gameFont->MeasureString(rString.String.c_str()));
-				float width = size.x * rString.Scale;
+				float width = line.Width * rString.Scale;
 
 				rString.X = (flags & PRINTSTRING_CENTER) ? ((pos.x * factor.x) - (width / 2.0f)) : (pos.x * factor.x);
 				rString.Y = (pos.y * UIScale) + yOffset;
@@ -123,5 +123,6 @@ namespace TEN::Renderer
 
 		m_blinkUpdated = false;
 		m_strings.clear();
+		m_textLayoutCache.EndFrame();
 	}
 }
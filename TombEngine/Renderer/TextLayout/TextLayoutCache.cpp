@@ -0,0 +1,69 @@
+#include "framework.h"
+#include "Renderer/TextLayout/TextLayoutCache.h"
+
+#include "Specific/trutils.h"
+
+using namespace TEN::Utils;
+
+namespace TEN::Renderer
+{
+	unsigned int TextLayoutCache::GetEntryCount() const
+	{
+		return (unsigned int)Entries.size();
+	}
+
+	unsigned int TextLayoutCache::GetMissCount() const
+	{
+		return MissCount;
+	}
+
+	const TextLayout& TextLayoutCache::GetLayout(const std::string& string, const void* fontKey, const MeasureFunction& measure)
+	{
+		auto& entry = Entries[string];
+		entry.LastUsedFrame = FrameCount;
+
+		// Layout is valid if already built for same font.
+		if (entry.FontKey == fontKey && !entry.Layout.Lines.empty())
+			return entry.Layout;
+
+		MissCount++;
+
+		entry.Layout.Lines.clear();
+
+		for (const auto& line : SplitString(string))
+		{
+			auto textLine = TextLine{};
+			textLine.String = ToWString(line);
+			textLine.Width = measure(textLine.String);
+			entry.Layout.Lines.push_back(std::move(textLine));
+		}
+
+		// Set last, so that layout is rebuilt if conversion or measurement throws.
+		entry.FontKey = fontKey;
+		return entry.Layout;
+	}
+
+	void TextLayoutCache::Clear()
+	{
+		Entries.clear();
+	}
+
+	void TextLayoutCache::EndFrame()
+	{
+		// Drop layouts not used during this frame only when cache grows too large, so that text
+		// alternating between frames (e.g. blinking prompts) keeps its layout.
+		if (Entries.size() > ENTRY_COUNT_MAX)
+		{
+			for (auto it = Entries.begin(); it != Entries.end();)
+			{
+				if (it->second.LastUsedFrame != FrameCount)
+					it = Entries.erase(it);
+				else
+					it++;
+			}
+		}
+
+		FrameCount++;
+		MissCount = 0;
+	}
+}
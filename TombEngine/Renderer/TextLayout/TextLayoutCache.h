@@ -0,0 +1,54 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Text layout cache.
+// Strings are split into lines, converted to wide strings and measured once, then reused while same text
+// is drawn with same font. Layouts are in unscaled font units, so scale and position are applied by caller.
+
+namespace TEN::Renderer
+{
+	struct TextLine
+	{
+		std::wstring String = {};
+		float		 Width	= 0.0f; // Unscaled font units.
+	};
+
+	struct TextLayout
+	{
+		std::vector<TextLine> Lines = {};
+	};
+
+	class TextLayoutCache
+	{
+	private:
+		struct Entry
+		{
+			TextLayout	 Layout		   = {};
+			const void*	 FontKey	   = nullptr;
+			unsigned int LastUsedFrame = 0;
+		};
+
+		// Constants
+		static constexpr auto ENTRY_COUNT_MAX = 256;
+
+		// Members
+		std::unordered_map<std::string, Entry> Entries	  = {};
+		unsigned int						   FrameCount = 0;
+		unsigned int						   MissCount  = 0;
+
+	public:
+		using MeasureFunction = std::function<float(const std::wstring& string)>;
+
+		// Getters
+		unsigned int GetEntryCount() const;
+		unsigned int GetMissCount() const;
+
+		// Utilities
+		const TextLayout& GetLayout(const std::string& string, const void* fontKey, const MeasureFunction& measure);
+		void Clear();
+		void EndFrame();
+	};
+}
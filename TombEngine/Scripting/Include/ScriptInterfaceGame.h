@@ -66,8 +66,9 @@ public:
 	virtual void ExecuteFunction(const std::string& luaFuncName, TEN::Control::Volumes::VolumeActivator, const std::string& arguments) = 0;
 	virtual void ExecuteFunction(const std::string& luaFuncName, short idOne, short idTwo = 0) = 0;
 
-	virtual void GetVariables(std::vector<SavedVar>& vars) = 0;
-	virtual void SetVariables(const std::vector<SavedVar>& vars) = 0;
+	virtual void SaveVariables(std::vector<byte>& data) = 0;
+	virtual void LoadVariables(std::vector<byte>& data) = 0;
+	virtual void SetVariables(const std::vector<SavedVar>& vars) = 0; // Savegames written before variable stream.
 
 	virtual void GetCallbackStrings(std::vector<std::string>& preControl, std::vector<std::string>& postControl) const = 0;
 	virtual void SetCallbackStrings(const std::vector<std::string>& preControl, const std::vector<std::string>& postControl) = 0;
@@ -11,7 +11,8 @@ class ScriptInterfaceStringsHandler
 {
 public:
 	virtual ~ScriptInterfaceStringsHandler() = default;
-	virtual void ProcessDisplayStrings(float deltaTime) = 0;
+	virtual void UpdateDisplayStrings(float deltaTime) = 0;
+	virtual void DrawDisplayStrings() = 0;
 	virtual void ClearDisplayStrings() = 0;
 	virtual void SetCallbackDrawString(CallbackDrawString) = 0;
 };
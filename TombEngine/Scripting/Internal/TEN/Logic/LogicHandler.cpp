@@ -12,8 +12,10 @@
 #include "Rotation/Rotation.h"
 #include "Color/Color.h"
 #include "LevelFunc.h"
+#include "VariableSerializer.h"
 
 using namespace TEN::Effects::Electricity;
+using namespace TEN::Scripting;
 
 /***
 Saving data, triggering functions, and callbacks for level-specific scripts.
@@ -344,28 +346,36 @@ void LogicHandler::FreeLevelScripts()
 	m_handler.GetState()->collect_garbage();
 }
 
-//Used when loading
+//Used when loading savegames written before variable stream
 void LogicHandler::SetVariables(std::vector<SavedVar> const & vars)
 {
 	ResetGameTables();
 	ResetLevelTables();
 
-	std::unordered_map<uint32_t, sol::table> solTables;
+	// Tables are indexed by var index. Unset entries are invalid references until created.
+	std::vector<sol::table> solTables(vars.size());
+
+	auto getSolTable = [&](std::size_t index) -> sol::table&
+	{
+		if (!solTables[index].valid())
+			solTables[index] = sol::table{ *m_handler.GetState(), sol::create };
+
+		return solTables[index];
+	};
 
 	for(std::size_t i = 0; i < vars.size(); ++i)
 	{
 		if (std::holds_alternative<IndexTable>(vars[i]))
 		{
-			solTables.try_emplace(i, *m_handler.GetState(), sol::create);
-			auto indexTab = std::get<IndexTable>(vars[i]);
+			auto& solTable = getSolTable(i);
+			const auto& indexTab = std::get<IndexTable>(vars[i]);
 			for (auto& [first, second] : indexTab)
 			{
 				// if we're wanting to reference a table, make sure that table exists
 				// create it if need be
 				if (std::holds_alternative<IndexTable>(vars[second]))
 				{
-					solTables.try_emplace(second, *m_handler.GetState(), sol::create);
-					solTables[i][vars[first]] = solTables[second];
+					solTable[vars[first]] = getSolTable(second);
 				}
 				else if (std::holds_alternative<double>(vars[second]))
 				{
@@ -377,45 +387,51 @@ void LogicHandler::SetVariables(std::vector<SavedVar> const & vars)
 					// outside of these bounds? - squidshire 30/04/2022
 					if (std::trunc(theNum) == theNum && theNum <= INT64_MAX && theNum >= INT64_MIN)
 					{
-						solTables[i][vars[first]] = (int64_t)theNum;
+						solTable[vars[first]] = (int64_t)theNum;
 					}
 					else
 					{
-						solTables[i][vars[first]] = vars[second];
+						solTable[vars[first]] = vars[second];
 					}
 				}
 				else if (vars[second].index() == int(SavedVarType::Vec3))
 				{
 					auto theVec = Vec3{ std::get<int(SavedVarType::Vec3)>(vars[second]) };
-					solTables[i][vars[first]] = theVec;
+					solTable[vars[first]] = theVec;
 				}
 				else if (vars[second].index() == int(SavedVarType::Rotation))
 				{
 					auto theVec = Rotation{ std::get<int(SavedVarType::Rotation)>(vars[second]) };
-					solTables[i][vars[first]] = theVec;
+					solTable[vars[first]] = theVec;
 				}
 				else if (vars[second].index() == int(SavedVarType::Color))
 				{
 					auto theCol = D3DCOLOR{std::get<int(SavedVarType::Color)>(vars[second]) };
-					solTables[i][vars[first]] = ScriptColor{theCol};
+					solTable[vars[first]] = ScriptColor{theCol};
 				}
 				else if (std::holds_alternative<FuncName>(vars[second]))
 				{
 					LevelFunc fnh;
 					fnh.m_funcName = std::get<FuncName>(vars[second]).name;
 					fnh.m_handler = this;
-					solTables[i][vars[first]] = fnh;
+					solTable[vars[first]] = fnh;
 				}
 				else
 				{
-					solTables[i][vars[first]] = vars[second];
+					solTable[vars[first]] = vars[second];
 				}
 			}
 		}
 	}
 	
-	auto rootTable = solTables[0];
+	if (vars.empty())
+		return;
+
+	ApplyVariables(getSolTable(0));
+}
 
+void LogicHandler::ApplyVariables(const sol::table& rootTable)
+{
 	sol::table levelVars = rootTable[ScriptReserved_LevelVars];
 	for (auto& [first, second] : levelVars)
 	{
@@ -430,220 +446,27 @@ void LogicHandler::SetVariables(std::vector<SavedVar> const & vars)
 }
 
 
-template<SavedVarType TypeEnum, typename TypeTo, typename TypeFrom, typename MapType> int32_t Handle(TypeFrom & var, MapType & varsMap, size_t & nVars, std::vector<SavedVar> & vars)
-{
-	auto [first, second] = varsMap.insert(std::make_pair(&var, nVars));
-
-	if (second)
-	{
-		SavedVar savedVar;
-		TypeTo varTo = (TypeTo)var;
-		savedVar.emplace<(int)TypeEnum>(varTo);
-		vars.push_back(varTo);
-		++nVars;
-	}
-
-	return first->second;
-}
-
-std::string LogicHandler::GetRequestedPath() const
-{
-	std::string path;
-	for (uint32_t i = 0; i < m_savedVarPath.size(); ++i)
-	{
-		auto key = m_savedVarPath[i];
-		if (std::holds_alternative<uint32_t>(key))
-		{
-			path += "[" + std::to_string(std::get<uint32_t>(key)) + "]";
-		}
-		else if (std::holds_alternative<std::string>(key))
-		{
-			auto part = std::get<std::string>(key);
-			if (i > 0)
-			{
-				path += "." + part;
-			}
-			else
-			{
-				path += part;
-			};
-		}
-	}
-	return path;
-}
-
 //Used when saving
-void LogicHandler::GetVariables(std::vector<SavedVar> & vars)
+void LogicHandler::SaveVariables(std::vector<byte>& data)
 {
 	sol::table tab{ *m_handler.GetState(), sol::create };
 	tab[ScriptReserved_LevelVars] = (*m_handler.GetState())[ScriptReserved_LevelVars];
 	tab[ScriptReserved_GameVars] = (*m_handler.GetState())[ScriptReserved_GameVars];
 
-	std::unordered_map<void const*, uint32_t> varsMap;
-	std::unordered_map<double, uint32_t> numMap;
-	std::unordered_map<bool, uint32_t> boolMap;
-
-	size_t nVars = 0;
-
-	// The following functions will all try to put their values in a map. If it succeeds
-	// then the value was not already in the map, so we can put it into the var vector.
-	// If it fails, the value is in the map, and thus will also be in the var vector.
-	// We then return the value's position in the var vector.
-
-	// The purpose of this is to only store each value once, and to fill our tables with
-	// indices to the values rather than copies of the values.
-
-	auto handleNum = [&](auto num, auto map)
-	{
-		auto [first, second] = map.insert(std::make_pair(num, nVars));
-
-		if (second)
-		{
-			vars.push_back(num);
-			++nVars;
-		}
-
-		return first->second;
-	};
-
-	auto handleStr = [&](sol::object const& obj)
-	{
-		auto str = obj.as<sol::string_view>();
-		auto [first, second] = varsMap.insert(std::make_pair(str.data(), nVars));
-
-		if (second)
-		{
-			vars.push_back(std::string{ str.data() });
-			++nVars;
-		}
-
-		return first->second;
-	};
-
-	auto handleFuncName = [&](LevelFunc const& fnh)
-	{
-		auto [first, second] = varsMap.insert(std::make_pair(&fnh, nVars));
-
-		if (second)
-		{
-			vars.push_back(FuncName{ std::string{ fnh.m_funcName } });
-			++nVars;
-		}
-
-		return first->second;
-	};
-
-	std::function<uint32_t(const sol::table&)> populate = [&](const sol::table& obj) 
-	{
-		auto [first, second] = varsMap.insert(std::make_pair(obj.pointer(), nVars));
-
-		if(second)
-		{
-			++nVars;
-			auto id = first->second;
-
-			vars.push_back(IndexTable{});
-
-			for (auto& [first, second] : obj)
-			{
-				bool validKey = true;
-				uint32_t keyIndex = 0;
-				std::variant<std::string, uint32_t> key{uint32_t(0)};
-				// Strings and numbers can be keys AND values
-				switch (first.get_type())
-				{
-				case sol::type::string:
-				{
-					keyIndex = handleStr(first);
-					key = std::string{ first.as<sol::string_view>().data() };
-					m_savedVarPath.push_back(key);
-				}
-					break;
-
-				case sol::type::number:
-				{
-					if (double data = first.as<double>(); std::floor(data) != data)
-					{
-						ScriptAssert(false, "Tried using a non-integer number " + std::to_string(data) + " as a key in table " + GetRequestedPath());
-						validKey = false;
-					}
-					else
-					{
-						keyIndex = handleNum(data, numMap);
-						key = static_cast<uint32_t>(data);
-						m_savedVarPath.push_back(key);
-					}
-				}
-					break;
-
-				default:
-					validKey = false;
-					ScriptAssert(false, "Tried using an unsupported type as a key in table " + GetRequestedPath());
-				}
-
-				if (!validKey)
-					continue;
-
-				auto putInVars = [&vars, id, keyIndex](uint32_t valIndex)
-				{
-					std::get<IndexTable>(vars[id]).push_back(std::make_pair(keyIndex, valIndex));
-				};
-
-				switch (second.get_type())
-				{
-				case sol::type::table:
-					putInVars(populate(second.as<sol::table>()));
-					break;
-
-				case sol::type::string:
-					putInVars(handleStr(second));
-					break;
-
-				case sol::type::number:
-					putInVars(handleNum(second.as<double>(), numMap));
-					break;
-
-				case sol::type::boolean:
-					putInVars(handleNum(second.as<bool>(), boolMap));
-					break;
-
-				case sol::type::userdata:
-				{
-					if (second.is<Vec3>())
-					{
-						putInVars(Handle<SavedVarType::Vec3, Vector3i>(second.as<Vec3>(), varsMap, nVars, vars));
-					}
-					else if (second.is<Rotation>())
-					{
-						putInVars(Handle<SavedVarType::Rotation, Vector3>(second.as<Rotation>(), varsMap, nVars, vars));
-					}
-					else if (second.is<ScriptColor>())
-					{
-						putInVars(Handle<SavedVarType::Color, D3DCOLOR>(second.as<ScriptColor>(), varsMap, nVars, vars));
-					}
-					else if (second.is<LevelFunc>())
-					{
-						putInVars(handleFuncName(second.as<LevelFunc>()));
-					}
-					else
-					{
-						ScriptAssert(false, "Tried saving an unsupported userdata as a value; variable is " + GetRequestedPath());
-					}
-				}
-					break;
-
-				default:
-					ScriptAssert(false, "Tried saving an unsupported type as a value; variable is " + GetRequestedPath());
-				}
+	WriteVariables(tab, data);
+}
 
-				m_savedVarPath.pop_back();
-			}
-		}
+//Used when loading
+void LogicHandler::LoadVariables(std::vector<byte>& data)
+{
+	ResetGameTables();
+	ResetLevelTables();
 
-		return first->second;
-	};
+	auto rootTable = ReadVariables(*m_handler.GetState(), *this, data);
+	if (rootTable.get_type() != sol::type::table)
+		return;
 
-	populate(tab);
+	ApplyVariables(rootTable.as<sol::table>());
 }
 
 void LogicHandler::GetCallbackStrings(std::vector<std::string>& preControl, std::vector<std::string>& postControl) const
@@ -59,14 +59,11 @@ private:
 	std::unordered_set<std::string> m_callbacksPreControl;
 	std::unordered_set<std::string> m_callbacksPostControl;
 
-	std::vector<std::variant<std::string, uint32_t>> m_savedVarPath;
-
 	bool m_shortenedCalls = false;
 
-	std::string GetRequestedPath() const;
-
 	void ResetLevelTables();
 	void ResetGameTables();
+	void ApplyVariables(const sol::table& rootTable);
 	LuaHandler m_handler;
 
 public:	
@@ -94,7 +91,8 @@ public:
 
 	void								ExecuteFunction(std::string const& name, short idOne, short idTwo) override;
 
-	void								GetVariables(std::vector<SavedVar>& vars) override;
+	void								SaveVariables(std::vector<byte>& data) override;
+	void								LoadVariables(std::vector<byte>& data) override;
 	void								SetVariables(const std::vector<SavedVar>& vars) override;
 	void								ResetVariables();
 
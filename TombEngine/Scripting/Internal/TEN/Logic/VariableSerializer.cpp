@@ -0,0 +1,481 @@
+#include "framework.h"
+#include "VariableSerializer.h"
+
+#include "Color/Color.h"
+#include "LevelFunc.h"
+#include "Rotation/Rotation.h"
+#include "ScriptAssert.h"
+#include "Specific/IO/LEB128.h"
+#include "Specific/IO/Streams.h"
+#include "Vec3/Vec3.h"
+
+namespace TEN::Scripting
+{
+	constexpr auto VARIABLE_STREAM_VERSION = 1;
+	constexpr auto NO_INDEX = -1;
+
+	enum class VariableTag : byte
+	{
+		End,	   // Ends table.
+		False,
+		True,
+		Integer,   // 64-bit LEB128 value.
+		Number,	   // 8-byte double.
+		String,	   // LEB128 length and characters. Receives next string index.
+		StringRef, // LEB128 string index.
+		Table,	   // Key-value pairs until End. Receives next table index.
+		TableRef,  // LEB128 table index.
+		Vec3,	   // 3 LEB128 components.
+		Rotation,  // 3 floats.
+		Color,	   // 4-byte D3DCOLOR.
+		LevelFunc  // Function path as String or StringRef.
+	};
+
+	class VariableWriter
+	{
+	private:
+		// Members
+		VectorStream Stream;
+
+		std::unordered_map<const void*, int>	  TableIndices	= {};
+		std::unordered_map<std::string_view, int> StringIndices = {}; // Views into Lua strings, which outlive writing.
+		std::vector<std::string>				  Path			= {}; // Current key path, for error messages.
+
+	public:
+		// Constructors
+		VariableWriter(std::vector<byte>& data) : Stream(data)
+		{
+		}
+
+		// Utilities
+		void WriteRoot(const sol::table& root)
+		{
+			Stream.WriteByte(VARIABLE_STREAM_VERSION);
+			WriteTable(root);
+		}
+
+	private:
+		// Helpers
+		std::string GetPath() const
+		{
+			auto path = std::string{};
+			for (const auto& part : Path)
+				path += part;
+
+			return path;
+		}
+
+		void WriteTag(VariableTag tag)
+		{
+			Stream.WriteByte((byte)tag);
+		}
+
+		void WriteString(std::string_view string)
+		{
+			auto [it, isNew] = StringIndices.try_emplace(string, (int)StringIndices.size());
+			if (!isNew)
+			{
+				WriteTag(VariableTag::StringRef);
+				LEB128::Write(&Stream, it->second);
+				return;
+			}
+
+			WriteTag(VariableTag::String);
+			LEB128::Write(&Stream, (long)string.size());
+			Stream.Write(string.data(), (int)string.size());
+		}
+
+		void WriteNumber(const sol::object& number)
+		{
+			// Lua integers are written exactly, as double can't hold whole int64 range.
+			if (IsInteger(number))
+			{
+				WriteTag(VariableTag::Integer);
+				LEB128::WriteLongLong(&Stream, number.as<int64_t>());
+				return;
+			}
+
+			// Whole numbers are written and loaded as integers, so that value saved as 1 isn't loaded as 1.0.
+			double value = number.as<double>();
+			if (std::trunc(value) == value && value >= (double)INT64_MIN && value < -(double)INT64_MIN)
+			{
+				WriteTag(VariableTag::Integer);
+				LEB128::WriteLongLong(&Stream, (int64_t)value);
+				return;
+			}
+
+			WriteTag(VariableTag::Number);
+			Stream.Write((const char*)&value, sizeof(value));
+		}
+
+		static bool IsInteger(const sol::object& number)
+		{
+			auto* state = number.lua_state();
+			number.push();
+			bool isInteger = lua_isinteger(state, -1);
+			lua_pop(state, 1);
+			return isInteger;
+		}
+
+		bool TestKey(const sol::object& key)
+		{
+			switch (key.get_type())
+			{
+			case sol::type::string:
+				return true;
+
+			case sol::type::number:
+			{
+				double value = key.as<double>();
+				return ScriptAssert(std::floor(value) == value,
+					"Tried using a non-integer number " + std::to_string(value) + " as a key in table " + GetPath());
+			}
+
+			default:
+				return ScriptAssert(false, "Tried using an unsupported type as a key in table " + GetPath());
+			}
+		}
+
+		bool TestValue(const sol::object& value)
+		{
+			switch (value.get_type())
+			{
+			case sol::type::table:
+			case sol::type::string:
+			case sol::type::number:
+			case sol::type::boolean:
+				return true;
+
+			case sol::type::userdata:
+				return ScriptAssert(value.is<Vec3>() || value.is<Rotation>() || value.is<ScriptColor>() || value.is<LevelFunc>(),
+					"Tried saving an unsupported userdata as a value; variable is " + GetPath());
+
+			default:
+				return ScriptAssert(false, "Tried saving an unsupported type as a value; variable is " + GetPath());
+			}
+		}
+
+		void WriteKey(const sol::object& key)
+		{
+			if (key.get_type() == sol::type::string)
+			{
+				auto string = key.as<std::string_view>();
+				Path.push_back(Path.empty() ? std::string(string) : ("." + std::string(string)));
+				WriteString(string);
+			}
+			else
+			{
+				Path.push_back("[" + std::to_string(IsInteger(key) ? key.as<int64_t>() : (int64_t)key.as<double>()) + "]");
+				WriteNumber(key);
+			}
+		}
+
+		void WriteValue(const sol::object& value)
+		{
+			switch (value.get_type())
+			{
+			case sol::type::table:
+				WriteTable(value.as<sol::table>());
+				break;
+
+			case sol::type::string:
+				WriteString(value.as<std::string_view>());
+				break;
+
+			case sol::type::number:
+				WriteNumber(value);
+				break;
+
+			case sol::type::boolean:
+				WriteTag(value.as<bool>() ? VariableTag::True : VariableTag::False);
+				break;
+
+			case sol::type::userdata:
+				if (value.is<Vec3>())
+				{
+					auto vector = (Vector3i)value.as<Vec3>();
+					WriteTag(VariableTag::Vec3);
+					LEB128::Write(&Stream, vector.x);
+					LEB128::Write(&Stream, vector.y);
+					LEB128::Write(&Stream, vector.z);
+				}
+				else if (value.is<Rotation>())
+				{
+					auto vector = (Vector3)value.as<Rotation>();
+					WriteTag(VariableTag::Rotation);
+					Stream.WriteFloat(vector.x);
+					Stream.WriteFloat(vector.y);
+					Stream.WriteFloat(vector.z);
+				}
+				else if (value.is<ScriptColor>())
+				{
+					WriteTag(VariableTag::Color);
+					Stream.WriteInt32((int)(D3DCOLOR)value.as<ScriptColor>());
+				}
+				else if (value.is<LevelFunc>())
+				{
+					WriteTag(VariableTag::LevelFunc);
+					WriteString(value.as<LevelFunc&>().m_funcName);
+				}
+
+				break;
+			}
+		}
+
+		void WriteTable(const sol::table& table)
+		{
+			// Table already written; reference it, which also terminates cycles.
+			auto [it, isNew] = TableIndices.try_emplace(table.pointer(), (int)TableIndices.size());
+			if (!isNew)
+			{
+				WriteTag(VariableTag::TableRef);
+				LEB128::Write(&Stream, it->second);
+				return;
+			}
+
+			WriteTag(VariableTag::Table);
+			for (const auto& [key, value] : table)
+			{
+				if (!TestKey(key))
+					continue;
+
+				WriteKey(key);
+				if (TestValue(value))
+				{
+					WriteValue(value);
+				}
+				else
+				{
+					// Key is already written; pair it with a value which is dropped on load.
+					WriteTag(VariableTag::End);
+				}
+
+				Path.pop_back();
+			}
+
+			WriteTag(VariableTag::End);
+		}
+	};
+
+	class VariableReader
+	{
+	private:
+		// Members
+		VectorStream  Stream;
+		int			  Size		= 0;
+		sol::state&	  State;
+		LogicHandler& Handler;
+		bool		  IsCorrupt = false;
+
+		std::vector<sol::table>	 Tables	 = {};
+		std::vector<std::string> Strings = {};
+
+	public:
+		// Constructors
+		VariableReader(sol::state& state, LogicHandler& handler, std::vector<byte>& data) :
+			Stream(data),
+			Size((int)data.size()),
+			State(state),
+			Handler(handler)
+		{
+		}
+
+		// Utilities
+		sol::object ReadRoot()
+		{
+			byte version = 0;
+			if (!Stream.ReadByte(&version) || version != VARIABLE_STREAM_VERSION)
+			{
+				TENLog("Unsupported script variable data version " + std::to_string(version) + ".", LogLevel::Warning);
+				return sol::nil;
+			}
+
+			auto root = ReadValue(ReadTag());
+			if (IsCorrupt || root.get_type() != sol::type::table)
+			{
+				TENLog("Script variable data is corrupt.", LogLevel::Warning);
+				return sol::nil;
+			}
+
+			return root;
+		}
+
+	private:
+		// Helpers
+		VariableTag ReadTag()
+		{
+			byte tag = 0;
+			if (!Stream.ReadByte(&tag))
+				IsCorrupt = true;
+
+			return (VariableTag)tag;
+		}
+
+		int ReadIndex(int count)
+		{
+			int index = LEB128::ReadInt32(&Stream);
+			if (index < 0 || index >= count)
+			{
+				IsCorrupt = true;
+				return NO_INDEX;
+			}
+
+			return index;
+		}
+
+		const std::string* ReadString(VariableTag tag)
+		{
+			if (tag == VariableTag::StringRef)
+			{
+				int index = ReadIndex((int)Strings.size());
+				return ((index == NO_INDEX) ? nullptr : &Strings[index]);
+			}
+
+			if (tag != VariableTag::String)
+			{
+				IsCorrupt = true;
+				return nullptr;
+			}
+
+			int length = LEB128::ReadInt32(&Stream);
+			if (length < 0 || length > (Size - Stream.GetCurrentPosition()))
+			{
+				IsCorrupt = true;
+				return nullptr;
+			}
+
+			auto& string = Strings.emplace_back(length, '\0');
+			Stream.Read(string.data(), length);
+			return &string;
+		}
+
+		sol::object ReadValue(VariableTag tag)
+		{
+			switch (tag)
+			{
+			case VariableTag::False:
+				return sol::make_object(State, false);
+
+			case VariableTag::True:
+				return sol::make_object(State, true);
+
+			case VariableTag::Integer:
+				return sol::make_object(State, (int64_t)LEB128::ReadLongLong(&Stream));
+
+			case VariableTag::Number:
+			{
+				double value = 0.0;
+				if (!Stream.Read((char*)&value, sizeof(value)))
+				{
+					IsCorrupt = true;
+					return sol::nil;
+				}
+
+				return sol::make_object(State, value);
+			}
+
+			case VariableTag::String:
+			case VariableTag::StringRef:
+			{
+				const auto* string = ReadString(tag);
+				if (string == nullptr)
+					return sol::nil;
+
+				return sol::make_object(State, *string);
+			}
+
+			case VariableTag::Table:
+				return ReadTable();
+
+			case VariableTag::TableRef:
+			{
+				int index = ReadIndex((int)Tables.size());
+				if (index == NO_INDEX)
+					return sol::nil;
+
+				return Tables[index];
+			}
+
+			case VariableTag::Vec3:
+			{
+				int x = LEB128::ReadInt32(&Stream);
+				int y = LEB128::ReadInt32(&Stream);
+				int z = LEB128::ReadInt32(&Stream);
+				return sol::make_object(State, Vec3(x, y, z));
+			}
+
+			case VariableTag::Rotation:
+			{
+				auto vector = Vector3::Zero;
+				Stream.ReadVector3(&vector);
+				return sol::make_object(State, Rotation(vector));
+			}
+
+			case VariableTag::Color:
+			{
+				int color = 0;
+				Stream.ReadInt32(&color);
+				return sol::make_object(State, ScriptColor((D3DCOLOR)color));
+			}
+
+			case VariableTag::LevelFunc:
+			{
+				const auto* name = ReadString(ReadTag());
+				if (name == nullptr)
+					return sol::nil;
+
+				auto levelFunc = LevelFunc{};
+				levelFunc.m_funcName = *name;
+				levelFunc.m_handler = &Handler;
+				return sol::make_object(State, levelFunc);
+			}
+
+			// Placeholder for dropped value.
+			case VariableTag::End:
+				return sol::nil;
+
+			default:
+				IsCorrupt = true;
+				return sol::nil;
+			}
+		}
+
+		sol::object ReadTable()
+		{
+			// Register table before reading its contents, so that nested references to it resolve.
+			auto table = sol::table(State, sol::create);
+			Tables.push_back(table);
+
+			while (!IsCorrupt)
+			{
+				auto keyTag = ReadTag();
+				if (keyTag == VariableTag::End)
+					break;
+
+				auto key = ReadValue(keyTag);
+				auto value = ReadValue(ReadTag());
+				if (key.get_type() != sol::type::lua_nil && value.get_type() != sol::type::lua_nil)
+					table[key] = value;
+			}
+
+			return table;
+		}
+	};
+
+	void WriteVariables(const sol::table& root, std::vector<byte>& data)
+	{
+		data.clear();
+
+		auto writer = VariableWriter(data);
+		writer.WriteRoot(root);
+	}
+
+	sol::object ReadVariables(sol::state& state, LogicHandler& handler, std::vector<byte>& data)
+	{
+		if (data.empty())
+			return sol::nil;
+
+		auto reader = VariableReader(state, handler, data);
+		return reader.ReadRoot();
+	}
+}
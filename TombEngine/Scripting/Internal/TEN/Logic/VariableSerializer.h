@@ -0,0 +1,20 @@
+#pragma once
+#include <vector>
+
+class LogicHandler;
+
+// Serialisation of LevelVars and GameVars into compact tagged binary stream, used by savegames.
+//
+// Every value is written as a one byte tag followed by its payload. Integers and lengths are LEB128-encoded.
+// Tables are written once, at their first occurrence, and receive next table index in order of appearance.
+// Any further occurrence, including cyclic ones, is written as reference to that index, so shared tables
+// and cycles are restored as such. Repeated strings are likewise written once and referenced afterwards.
+//
+// Keys may be strings or whole numbers. Values may be booleans, numbers, strings, tables, Vec3, Rotation,
+// Color and LevelFunc. Unsupported keys and values are reported through ScriptAssert and skipped.
+
+namespace TEN::Scripting
+{
+	void		WriteVariables(const sol::table& root, std::vector<byte>& data);
+	sol::object ReadVariables(sol::state& state, LogicHandler& handler, std::vector<byte>& data); // Returns nil if data is empty or corrupt.
+}
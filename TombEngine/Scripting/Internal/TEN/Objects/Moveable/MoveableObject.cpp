@@ -10,6 +10,7 @@
 #include "Specific/level.h"
 #include "Specific/setup.h"
 #include "Math/Math.h"
+#include "Objects/TR5/Object/tr5_pushableblock.h"
 
 #include "ScriptAssert.h"
 #include "MoveableObject.h"
@@ -22,6 +23,7 @@
 #include "Vec3/Vec3.h"
 
 using namespace TEN::Effects::Items;
+using namespace TEN::Entities::Generic;
 
 /***
 Represents any object inside the game world.
@@ -438,6 +440,7 @@ void Moveable::SetObjectID(GAME_OBJECT_ID id)
 {
 	m_item->ObjectNumber = id;
 	m_item->ResetModelToDefault();
+	UpdatePushableStackIndex(m_num);
 }
 
 void SetLevelFuncCallback(TypeOrNil<LevelFunc> const & cb, std::string const & callerName, Moveable & mov, std::string & toModify)
@@ -576,6 +579,8 @@ void Moveable::SetPos(Vec3 const& pos, sol::optional<bool> updateRoom)
 				SetRoomNumber(potentialNewRoom);
 		}
 	}
+
+	UpdatePushableStackIndex(m_num);
 }
 
 Vec3 Moveable::GetJointPos(int jointIndex) const
@@ -82,7 +82,8 @@ void StringsHandler::ShowString(DisplayString const & str, sol::optional<float>
 	it->second.m_isInfinite = !nSeconds.has_value();
 }
 
-void StringsHandler::ProcessDisplayStrings(float deltaTime)
+// Called once per logic tick, so that string lifetime doesn't depend on presentation rate.
+void StringsHandler::UpdateDisplayStrings(float deltaTime)
 {
 	auto it = std::begin(m_userDisplayStrings);
 	while (it != std::end(m_userDisplayStrings))
@@ -97,23 +98,32 @@ void StringsHandler::ProcessDisplayStrings(float deltaTime)
 		else
 		{
 			if (!endOfLife || str.m_isInfinite)
-			{
-				char const* cstr = str.m_isTranslated ? g_GameFlow->GetString(str.m_key.c_str()) : str.m_key.c_str();
-				int flags = 0;
+				str.m_timeRemaining -= deltaTime;
+
+			++it;
+		}
+	}
+}
 
-				if (str.m_flags[static_cast<size_t>(DisplayStringOptions::CENTER)])
-					flags |= PRINTSTRING_CENTER;
+// Called once per presented frame.
+void StringsHandler::DrawDisplayStrings()
+{
+	for (const auto& [id, str] : m_userDisplayStrings)
+	{
+		bool endOfLife = 0.0f >= str.m_timeRemaining;
+		if (endOfLife && !str.m_isInfinite)
+			continue;
 
-				if (str.m_flags[static_cast<size_t>(DisplayStringOptions::OUTLINE)])
-					flags |= PRINTSTRING_OUTLINE;
+		char const* cstr = str.m_isTranslated ? g_GameFlow->GetString(str.m_key.c_str()) : str.m_key.c_str();
+		int flags = 0;
 
-				m_callbackDrawSring(cstr, str.m_color, str.m_x, str.m_y, flags);
+		if (str.m_flags[static_cast<size_t>(DisplayStringOptions::CENTER)])
+			flags |= PRINTSTRING_CENTER;
 
-				str.m_timeRemaining -= deltaTime;
-			}
+		if (str.m_flags[static_cast<size_t>(DisplayStringOptions::OUTLINE)])
+			flags |= PRINTSTRING_OUTLINE;
 
-			++it;
-		}
+		m_callbackDrawSring(cstr, str.m_color, str.m_x, str.m_y, flags);
 	}
 }
 
@@ -15,7 +15,8 @@ private:
 public:
 	StringsHandler(sol::state* lua, sol::table & parent);
 	void								SetCallbackDrawString(CallbackDrawString cb) override;
-	void								ProcessDisplayStrings(float dt) override;
+	void								UpdateDisplayStrings(float deltaTime) override;
+	void								DrawDisplayStrings() override;
 	void								ClearDisplayStrings() override;
 	bool								SetDisplayString(DisplayStringIDType id, UserDisplayString const& ds);
 
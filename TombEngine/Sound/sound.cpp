@@ -7,11 +7,14 @@
 #include "Game/collision/collide_room.h"
 #include "Game/Lara/lara.h"
 #include "Game/room.h"
+#include "Math/Random.h"
 #include "Specific/setup.h"
 #include "Specific/configuration.h"
 #include "Specific/level.h"
 #include "Specific/winmain.h"
 
+using namespace TEN::Math::Random;
+
 HSTREAM BASS_3D_Mixdown;
 HFX BASS_FXHandler[(int)SoundFilter::Count];
 SoundTrackSlot BASS_Soundtrack[(int)SoundTrackType::Count];
@@ -145,6 +148,9 @@ bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition, float
 	if (!g_Configuration.EnableSound)
 		return false;
 
+	// Sound randomisation depends on user settings and listener position, so it must not touch gameplay stream.
+	auto streamScope = RandomStreamScope(RandomStream::Audio);
+
 	if (effectID >= g_Level.SoundMap.size())
 		return false;
 
@@ -383,6 +389,8 @@ void PlaySoundTrack(std::string track, SoundTrackType mode, QWORD position)
 	if (!g_Configuration.EnableSound)
 		return;
 
+	auto streamScope = RandomStreamScope(RandomStream::Audio);
+
 	if (track.empty())
 		return;
 
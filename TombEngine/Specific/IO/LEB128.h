@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <climits>
 
 #include "Specific/IO/Streams.h"
 
@@ -33,6 +34,30 @@ struct LEB128
 		}
 		while ((currentByte & 0x80) != 0);
 
+		// Sign extend
+		int shift = (int)(sizeof(long) * CHAR_BIT) - currentShift;
+		if (shift > 0)
+			result = (result << shift) >> shift;
+
+		return result;
+	}
+
+	static long long ReadLongLong(BaseStream* stream)
+	{
+		long long result = 0;
+		int currentShift = 0;
+
+		byte currentByte;
+		do
+		{
+			stream->Read(reinterpret_cast<char *>(&currentByte), 1);
+
+			if (currentShift < 64)
+				result |= (long long)(currentByte & 0x7F) << currentShift;
+			currentShift += 7;
+		}
+		while ((currentByte & 0x80) != 0);
+
 		// Sign extend
 		int shift = 64 - currentShift;
 		if (shift > 0)
@@ -101,6 +126,25 @@ struct LEB128
 		Write(stream, value, value);
 	}
 
+	static void WriteLongLong(BaseStream* stream, long long value)
+	{
+		do
+		{
+			// Write byte
+			byte currentByte = ((byte)(value & 0x7F));
+			if (value >> 6 == 0 || value >> 6 == -1)
+			{
+				stream->WriteByte(currentByte);
+				return;
+			}
+
+			stream->WriteByte(currentByte | 0x80);
+
+			// Move data to next byte
+			value >>= 7;
+		} while (true);
+	}
+
 	static int GetLength(BaseStream* stream, long value)
 	{
 		int length = 1;
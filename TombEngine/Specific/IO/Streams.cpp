@@ -222,6 +222,59 @@ bool MemoryStream::Close()
 	return true;
 }
 
+VectorStream::VectorStream(std::vector<byte>& buffer) : m_buffer(buffer)
+{
+}
+
+bool VectorStream::Read(char* buffer, int length)
+{
+	if ((m_position + length) > (int)m_buffer.size())
+	{
+		memset(buffer, 0, length);
+		m_position = (int)m_buffer.size();
+		return false;
+	}
+
+	memcpy(buffer, m_buffer.data() + m_position, length);
+	m_position += length;
+	return true;
+}
+
+bool VectorStream::Write(char const * buffer, int length)
+{
+	if ((m_position + length) > (int)m_buffer.size())
+		m_buffer.resize(m_position + length);
+
+	memcpy(m_buffer.data() + m_position, buffer, length);
+	m_position += length;
+	return true;
+}
+
+int VectorStream::GetCurrentPosition()
+{
+	return m_position;
+}
+
+bool VectorStream::Seek(int seek, SeekOrigin origin)
+{
+	int position = (origin == SeekOrigin::BEGIN) ? seek : (m_position + seek);
+	if (position < 0 || position > (int)m_buffer.size())
+		return false;
+
+	m_position = position;
+	return true;
+}
+
+bool VectorStream::IsEOF()
+{
+	return (m_position >= (int)m_buffer.size());
+}
+
+bool VectorStream::Close()
+{
+	return true;
+}
+
 FileStream::FileStream(char* fileName, bool read, bool write)
 {
 	int mode = 0;
@@ -3,6 +3,7 @@
 #include <istream>
 #include <fstream>
 #include <string>
+#include <vector>
 #include <stdlib.h>
 #include <stdlib.h>
 #include <d3d11.h>
@@ -97,6 +98,29 @@ public:
 	bool Close();
 };
 
+// Growable in-memory stream over external byte vector. Writing past end extends vector.
+class VectorStream : public BaseStream
+{
+private:
+	std::vector<byte>& m_buffer;
+	int m_position = 0;
+
+public:
+	VectorStream(std::vector<byte>& buffer);
+
+	bool Read(char* buffer, int length);
+
+	bool Write(char const * buffer, int length);
+
+	int GetCurrentPosition();
+
+	bool Seek(int seek, SeekOrigin origin);
+
+	bool IsEOF();
+
+	bool Close();
+};
+
 class FileStream : public BaseStream
 {
 private:
@@ -7,6 +7,8 @@
 #include <OISJoyStick.h>
 #include <OISKeyboard.h>
 
+#include "Game/control/replay.h"
+#include "Game/debug/profiler.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
 #include "Game/Lara/lara_helpers.h"
@@ -602,6 +604,14 @@ namespace TEN::Input
 		if ((KeyMap[KC_F10] || KeyMap[KC_F11]) && dbDebugPage)
 			g_Renderer.SwitchDebugPage(KeyMap[KC_F10]);
 		dbDebugPage = (KeyMap[KC_F10] || KeyMap[KC_F11]) ? false : true;
+
+#ifdef TEN_PROFILER
+		// Export profiled frames.
+		static bool dbProfilerExport = true;
+		if (KeyMap[KC_F9] && dbProfilerExport)
+			TEN::Debug::g_Profiler.ExportChromeTrace(TEN::Debug::PROFILER_TRACE_PATH);
+		dbProfilerExport = KeyMap[KC_F9] ? false : true;
+#endif
 	}
 
 	void UpdateRumble()
@@ -658,6 +668,11 @@ namespace TEN::Input
 		UpdateRumble();
 		ReadKeyboard();
 		ReadGameController();
+
+		// Only gameplay ticks apply action queue, so only their input is recorded or replayed.
+		if (applyQueue)
+			TEN::Control::Replay::g_InputReplay.ProcessInput(KeyMap, AxisMap);
+
 		DefaultConflict();
 
 		// Update action map (mappable actions only).
@@ -1,40 +1,225 @@
 #include "framework.h"
 #include "Specific/clock.h"
 
-LARGE_INTEGER PerformanceCount;
-double LdFreq;
-double LdSync;
+#include <chrono>
+#include <thread>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+FramePacer g_FramePacer;
+
+FramePacer::FramePacer(const TimeSource& source)
+{
+	Initialize(source);
+}
+
+bool FramePacer::Initialize(const TimeSource& source)
+{
+	if (source.Frequency <= 0 || source.GetCounter == nullptr)
+		return false;
+
+	Source = source;
+	SpinTail = SPIN_TAIL_MIN_SEC * Source.Frequency;
+	Reset();
+	return true;
+}
+
+void FramePacer::Reset()
+{
+	if (Source.GetCounter == nullptr)
+		return;
+
+	LastTick = GetTick(Source.GetCounter());
+	LastFrameCounter = 0;
+	MaxOversleep = 0.0;
+
+	FrameTimes.fill(0.0);
+	FrameTimeIndex = 0;
+	FrameTimeCount = 0;
+}
+
+int FramePacer::Sync()
+{
+	double tick = GetTick(Source.GetCounter());
+	int tickCount = int((long long)tick - (long long)LastTick);
+
+	LastTick = tick;
+	return tickCount;
+}
+
+int FramePacer::WaitForTicks(int tickCountMin)
+{
+	auto counter = Source.GetCounter();
+	double tick = GetTick(counter);
+	int tickCount = int((long long)tick - (long long)LastTick);
+
+	if (tickCount < tickCountMin)
+	{
+		// Wait until required tick boundary is crossed rather than polling Sync().
+		WaitUntilTick(floor(LastTick) + tickCountMin);
+
+		counter = Source.GetCounter();
+		tick = GetTick(counter);
+		tickCount = int((long long)tick - (long long)LastTick);
+	}
+
+	LastTick = tick;
+	RegisterFrame(counter);
+	return tickCount;
+}
+
+double FramePacer::GetTime() const
+{
+	if (Source.GetCounter == nullptr)
+		return 0.0;
+
+	return GetTick(Source.GetCounter());
+}
+
+double FramePacer::GetLastSyncTime() const
+{
+	return LastTick;
+}
+
+FrameTimeMetrics FramePacer::GetMetrics() const
+{
+	auto metrics = FrameTimeMetrics{};
+	if (Source.Frequency <= 0)
+		return metrics;
+
+	metrics.SpinTailMs = (SpinTail * 1000.0) / Source.Frequency;
+	metrics.MaxOversleepMs = (MaxOversleep * 1000.0) / Source.Frequency;
+
+	if (FrameTimeCount == 0)
+		return metrics;
+
+	metrics.SampleCount = FrameTimeCount;
+	metrics.MinMs = FrameTimes[0];
+	metrics.MaxMs = FrameTimes[0];
+
+	double sum = 0.0;
+	for (unsigned int i = 0; i < FrameTimeCount; i++)
+	{
+		sum += FrameTimes[i];
+		metrics.MinMs = std::min(metrics.MinMs, FrameTimes[i]);
+		metrics.MaxMs = std::max(metrics.MaxMs, FrameTimes[i]);
+	}
+	metrics.AverageMs = sum / FrameTimeCount;
+
+	double variance = 0.0;
+	for (unsigned int i = 0; i < FrameTimeCount; i++)
+		variance += pow(FrameTimes[i] - metrics.AverageMs, 2);
+	metrics.JitterMs = sqrt(variance / FrameTimeCount);
+
+	return metrics;
+}
+
+double FramePacer::GetTick(long long counter) const
+{
+	return ((double)counter * SYNC_TICK_RATE) / Source.Frequency;
+}
+
+void FramePacer::WaitUntilTick(double tick)
+{
+	auto deadline = (long long)ceil((tick * Source.Frequency) / SYNC_TICK_RATE);
+
+	// Slowly shrink spin tail so that a single oversleep spike doesn't disable sleeping for good.
+	double spinTailMin = SPIN_TAIL_MIN_SEC * Source.Frequency;
+	double spinTailMax = SPIN_TAIL_MAX_SEC * Source.Frequency;
+	SpinTail = std::clamp(SpinTail * SPIN_TAIL_DECAY, spinTailMin, spinTailMax);
+
+	while (true)
+	{
+		auto counter = Source.GetCounter();
+		auto remaining = deadline - counter;
+		if (remaining <= 0)
+			break;
+
+		// Sleep through most of remaining time, then spin the tail to absorb scheduler overshoot.
+		if (Source.Sleep != nullptr && remaining > SpinTail)
+		{
+			auto sleepTime = remaining - (long long)SpinTail;
+			Source.Sleep(sleepTime);
+
+			double oversleep = double(Source.GetCounter() - counter - sleepTime);
+			if (oversleep > 0.0)
+			{
+				MaxOversleep = std::max(MaxOversleep, oversleep);
+				SpinTail = std::clamp(std::max(SpinTail, oversleep * 1.25), spinTailMin, spinTailMax);
+			}
+
+			continue;
+		}
+
+		std::this_thread::yield();
+	}
+}
+
+void FramePacer::RegisterFrame(long long counter)
+{
+	if (LastFrameCounter != 0)
+	{
+		FrameTimes[FrameTimeIndex] = ((counter - LastFrameCounter) * 1000.0) / Source.Frequency;
+		FrameTimeIndex = (FrameTimeIndex + 1) % FRAME_TIME_SAMPLE_COUNT;
+		FrameTimeCount = std::min<unsigned int>(FrameTimeCount + 1, FRAME_TIME_SAMPLE_COUNT);
+	}
+
+	LastFrameCounter = counter;
+}
+
+TimeSource GetSystemTimeSource()
+{
+	using Clock = std::chrono::steady_clock;
+
+	auto source = TimeSource{};
+	source.Frequency = Clock::period::den / Clock::period::num;
+	source.GetCounter = []()
+	{
+		return (long long)Clock::now().time_since_epoch().count();
+	};
+
+#ifdef _WIN32
+	// Default Sleep() granularity is too coarse for frame pacing, use high resolution waitable timer if available.
+	static HANDLE timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (timer != nullptr)
+	{
+		source.Sleep = [](long long counter)
+		{
+			auto dueTime = LARGE_INTEGER{};
+			dueTime.QuadPart = -(long long)((counter * 10000000.0) / (Clock::period::den / Clock::period::num));
+
+			if (SetWaitableTimer(timer, &dueTime, 0, nullptr, nullptr, FALSE))
+				WaitForSingleObject(timer, INFINITE);
+		};
+
+		return source;
+	}
+#endif
+
+	source.Sleep = [](long long counter)
+	{
+		std::this_thread::sleep_for(Clock::duration(counter));
+	};
+
+	return source;
+}
 
 bool TimeReset()
 {
-	LARGE_INTEGER fq;
-	QueryPerformanceCounter(&fq);
-	LdSync = (double)fq.LowPart + (double)fq.HighPart * (double)0xffffffff;
-	LdSync /= LdFreq;
+	g_FramePacer.Reset();
 	return true;
 }
 
 bool TimeInit()
 {
-	LARGE_INTEGER fq;
-	if (!QueryPerformanceFrequency(&fq))
-		return false;
-	LdFreq = (double)fq.LowPart + (double)fq.HighPart * (double)0xFFFFFFFF;
-	LdFreq /= 60.0;
-	TimeReset();
-	return true;
+	return g_FramePacer.Initialize(GetSystemTimeSource());
 }
 
 int Sync()
 {
-	LARGE_INTEGER ct;
-	double dCounter;
-	QueryPerformanceCounter(&ct);
-	dCounter = (double)ct.LowPart + (double)ct.HighPart * (double)0xFFFFFFFF;
-	dCounter /= LdFreq;
-	long nFrames = long(dCounter) - long(LdSync);
-	LdSync = dCounter;
-	return nFrames;
+	return g_FramePacer.Sync();
 }
 
 GameTime GetGameTime(int frameCount)
@@ -49,4 +234,4 @@ GameTime GetGameTime(int frameCount)
 	result.Seconds = (seconds % TIME_UNIT);
 
 	return result;
-}
\ No newline at end of file
+}
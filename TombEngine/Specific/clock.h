@@ -9,6 +9,9 @@ constexpr auto DELTA_TIME = 1.0f / FPS;
 constexpr auto TIME_UNIT  = 60;
 constexpr auto DAY_UNIT   = 24;
 
+// Sync() reports elapsed time in ticks of this rate. Two ticks make one game frame.
+constexpr auto SYNC_TICK_RATE = 60;
+
 struct GameTime
 {
 	int Days;
@@ -17,6 +20,75 @@ struct GameTime
 	int Seconds;
 };
 
+// Raw timer abstraction. Counter values are in arbitrary units, Frequency units per second.
+// Default source wraps std::chrono::steady_clock; a fake one can be substituted to drive the pacer deterministically.
+struct TimeSource
+{
+	long long Frequency = 0;
+
+	std::function<long long()>	   GetCounter = nullptr;
+	std::function<void(long long)> Sleep	  = nullptr; // Sleeps for approximately given amount of counter units.
+};
+
+struct FrameTimeMetrics
+{
+	unsigned int SampleCount = 0;
+
+	double AverageMs	  = 0.0;
+	double JitterMs		  = 0.0; // Standard deviation of frame time.
+	double MinMs		  = 0.0;
+	double MaxMs		  = 0.0;
+	double SpinTailMs	  = 0.0;
+	double MaxOversleepMs = 0.0;
+};
+
+class FramePacer
+{
+private:
+	// Constants
+	static constexpr auto FRAME_TIME_SAMPLE_COUNT = 120;
+	static constexpr auto SPIN_TAIL_MIN_SEC		  = 0.0005;
+	static constexpr auto SPIN_TAIL_MAX_SEC		  = 1.0 / FPS; // Degrades to spinning if sleep is too coarse.
+	static constexpr auto SPIN_TAIL_DECAY		  = 0.99;
+
+	// Members
+	TimeSource Source = {};
+
+	double	  LastTick		   = 0.0; // In fractional sync ticks.
+	long long LastFrameCounter = 0;
+	double	  SpinTail		   = 0.0; // In counter units.
+	double	  MaxOversleep	   = 0.0; // In counter units.
+
+	std::array<double, FRAME_TIME_SAMPLE_COUNT> FrameTimes = {};
+	unsigned int FrameTimeIndex = 0;
+	unsigned int FrameTimeCount = 0;
+
+public:
+	// Constructors
+	FramePacer() = default;
+	FramePacer(const TimeSource& source);
+
+	// Utilities
+	bool Initialize(const TimeSource& source);
+	void Reset();
+	int	 Sync();
+	int	 WaitForTicks(int tickCountMin);
+
+	double			 GetTime() const;
+	double			 GetLastSyncTime() const;
+	FrameTimeMetrics GetMetrics() const;
+
+private:
+	// Helpers
+	double GetTick(long long counter) const;
+	void   WaitUntilTick(double tick);
+	void   RegisterFrame(long long counter);
+};
+
+extern FramePacer g_FramePacer;
+
+TimeSource GetSystemTimeSource();
+
 int Sync();
 bool TimeInit();
 bool TimeReset();
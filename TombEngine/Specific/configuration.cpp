@@ -216,6 +216,30 @@ bool SaveConfiguration()
 		return false;
 	}
 
+	if (SetBoolRegKey(rootKey, REGKEY_FRAME_INTERPOLATION, g_Configuration.EnableFrameInterpolation) != ERROR_SUCCESS)
+	{
+		RegCloseKey(rootKey);
+		return false;
+	}
+
+	if (SetBoolRegKey(rootKey, REGKEY_PARALLEL_EFFECTS, g_Configuration.EnableParallelEffects) != ERROR_SUCCESS)
+	{
+		RegCloseKey(rootKey);
+		return false;
+	}
+
+	if (SetDWORDRegKey(rootKey, REGKEY_LOG_FLUSH_INTERVAL, g_Configuration.LogFlushInterval) != ERROR_SUCCESS)
+	{
+		RegCloseKey(rootKey);
+		return false;
+	}
+
+	if (SetDWORDRegKey(rootKey, REGKEY_LOG_FLUSH_LEVEL, DWORD(g_Configuration.LogFlushLevel)) != ERROR_SUCCESS)
+	{
+		RegCloseKey(rootKey);
+		return false;
+	}
+
 	if (SetBoolRegKey(rootKey, REGKEY_ENABLE_SOUND, g_Configuration.EnableSound) != ERROR_SUCCESS)
 	{
 		RegCloseKey(rootKey);
@@ -373,6 +397,19 @@ bool LoadConfiguration()
 		return false;
 	}
 
+	// Optional key, missing value must not invalidate configuration written by older versions.
+	bool enableFrameInterpolation = false;
+	GetBoolRegKey(rootKey, REGKEY_FRAME_INTERPOLATION, &enableFrameInterpolation, false);
+
+	bool enableParallelEffects = false;
+	GetBoolRegKey(rootKey, REGKEY_PARALLEL_EFFECTS, &enableParallelEffects, false);
+
+	DWORD logFlushInterval = 1;
+	GetDWORDRegKey(rootKey, REGKEY_LOG_FLUSH_INTERVAL, &logFlushInterval, 1);
+
+	DWORD logFlushLevel = DWORD(LogLevel::Error);
+	GetDWORDRegKey(rootKey, REGKEY_LOG_FLUSH_LEVEL, &logFlushLevel, DWORD(LogLevel::Error));
+
 	bool enableSound = true;
 	if (GetBoolRegKey(rootKey, REGKEY_ENABLE_SOUND, &enableSound, true) != ERROR_SUCCESS)
 	{
@@ -454,6 +491,8 @@ bool LoadConfiguration()
 	g_Configuration.EnableCaustics = caustics;
 	g_Configuration.Antialiasing = AntialiasingMode(antialiasing);
 	g_Configuration.ShadowMapSize = shadowMapSize;
+	g_Configuration.EnableFrameInterpolation = enableFrameInterpolation;
+	g_Configuration.EnableParallelEffects = enableParallelEffects;
 
 	g_Configuration.EnableSound = enableSound;
 	g_Configuration.EnableReverb = enableReverb;
@@ -465,6 +504,9 @@ bool LoadConfiguration()
 	g_Configuration.EnableRumble = enableRumble;
 	g_Configuration.EnableThumbstickCameraControl = enableThumbstickCamera;
 
+	g_Configuration.LogFlushInterval = logFlushInterval;
+	g_Configuration.LogFlushLevel = LogLevel(std::min<DWORD>(logFlushLevel, DWORD(LogLevel::Info)));
+
 	// Set legacy variables
 	SetVolumeMusic(musicVolume);
 	SetVolumeFX(sfxVolume);
@@ -15,6 +15,8 @@ using namespace TEN::Math;
 #define REGKEY_SHADOW_BLOBS				"ShadowBlobs"
 #define REGKEY_CAUSTICS					"Caustics"
 #define REGKEY_ANTIALIASING				"Antialiasing"
+#define REGKEY_FRAME_INTERPOLATION		"EnableFrameInterpolation"
+#define REGKEY_PARALLEL_EFFECTS			"EnableParallelEffects"
 
 #define REGKEY_SOUND_DEVICE				"SoundDevice"
 #define REGKEY_ENABLE_SOUND				"EnableSound"
@@ -27,6 +29,9 @@ using namespace TEN::Math;
 
 #define REGKEY_AUTOTARGET				"AutoTarget"
 
+#define REGKEY_LOG_FLUSH_INTERVAL		"LogFlushInterval"
+#define REGKEY_LOG_FLUSH_LEVEL			"LogFlushLevel"
+
 struct GameConfiguration 
 {
 	int Width;
@@ -44,12 +49,17 @@ struct GameConfiguration
 	ShadowMode ShadowType;
 	int ShadowMapSize = 1024;
 	int ShadowMaxBlobs = 16;
+	bool EnableFrameInterpolation = false;
+	bool EnableParallelEffects = false; // Serial fallback if disabled.
 
 	bool AutoTarget;
 	bool EnableRumble;
 	bool EnableThumbstickCameraControl;
 	short KeyboardLayout[TEN::Input::KEY_COUNT];
 
+	int LogFlushInterval = 1;				  // Seconds. 0 disables periodic flush.
+	LogLevel LogFlushLevel = LogLevel::Error; // Messages of this or higher severity are flushed immediately.
+
 	std::vector<Vector2i> SupportedScreenResolutions;
 	std::string AdapterName;
 };
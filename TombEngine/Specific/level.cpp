@@ -1,11 +1,12 @@
 #include "framework.h"
 #include "Specific/level.h"
 
-#include <process.h>
+#include <future>
 #include <zlib.h>
 
 #include "Game/animation.h"
 #include "Game/animation.h"
+#include "Game/collision/floordata.h"
 #include "Game/control/box.h"
 #include "Game/control/control.h"
 #include "Game/control/volume.h"
@@ -26,6 +27,7 @@
 #include "Scripting/Include/ScriptInterfaceLevel.h"
 #include "Sound/sound.h"
 #include "Specific/Input/Input.h"
+#include "Specific/memory/LevelArena.h"
 #include "Specific/setup.h"
 #include "Specific/trutils.h"
 
@@ -33,9 +35,10 @@ using TEN::Renderer::g_Renderer;
 
 using namespace TEN::Entities::Doors;
 using namespace TEN::Input;
+using namespace TEN::Memory;
 
 char* LevelDataPtr;
-bool IsLevelLoading;
+std::atomic<bool> IsLevelLoading;
 bool LoadedSuccessfully;
 std::vector<int> MoveablesIds;
 std::vector<int> StaticObjectsIds;
@@ -194,6 +197,40 @@ void LoadItems()
 	}
 }
 
+static POLYGON ReadPolygon(bool readShineStrength)
+{
+	auto* resource = &g_LevelArena;
+
+	int shape = ReadInt32();
+	int animatedSequence = ReadInt32();
+	int animatedFrame = ReadInt32();
+	float shineStrength = readShineStrength ? ReadFloat() : 0.0f;
+	int count = (shape == 0) ? 4 : 3;
+
+	auto poly = POLYGON
+	{
+		shape, animatedSequence, animatedFrame, shineStrength,
+		std::pmr::vector<int>(count, resource),
+		std::pmr::vector<Vector2>(count, resource),
+		std::pmr::vector<Vector3>(count, resource),
+		std::pmr::vector<Vector3>(count, resource),
+		std::pmr::vector<Vector3>(count, resource)
+	};
+
+	for (int i = 0; i < count; i++)
+		poly.indices[i] = ReadInt32();
+	for (int i = 0; i < count; i++)
+		poly.textureCoordinates[i] = ReadVector2();
+	for (int i = 0; i < count; i++)
+		poly.normals[i] = ReadVector3();
+	for (int i = 0; i < count; i++)
+		poly.tangents[i] = ReadVector3();
+	for (int i = 0; i < count; i++)
+		poly.bitangents[i] = ReadVector3();
+
+	return poly;
+}
+
 void LoadObjects()
 {
 	std::memset(Objects, 0, sizeof(ObjectInfo) * ID_NUMBER_OBJECTS);
@@ -244,42 +281,20 @@ void LoadObjects()
 			bucket.polygons.reserve(numPolygons);
 			for (int k = 0; k < numPolygons; k++)
 			{
-				POLYGON poly;
-
-				poly.shape = ReadInt32();
-				poly.animatedSequence = ReadInt32();
-				poly.animatedFrame = ReadInt32();
-				poly.shineStrength = ReadFloat();
-				int count = (poly.shape == 0 ? 4 : 3);
-				poly.indices.resize(count);
-				poly.textureCoordinates.resize(count);
-				poly.normals.resize(count);
-				poly.tangents.resize(count);
-				poly.bitangents.resize(count);
-				
-				for (int n = 0; n < count; n++)
-					poly.indices[n] = ReadInt32();
-				for (int n = 0; n < count; n++)
-					poly.textureCoordinates[n] = ReadVector2();
-				for (int n = 0; n < count; n++)
-					poly.normals[n] = ReadVector3();
-				for (int n = 0; n < count; n++)
-					poly.tangents[n] = ReadVector3();
-				for (int n = 0; n < count; n++)
-					poly.bitangents[n] = ReadVector3();
-
-				bucket.polygons.push_back(poly);
+				auto poly = ReadPolygon(true);
 
 				if (poly.shape == 0)
 					bucket.numQuads++;
 				else
 					bucket.numTriangles++;
+
+				bucket.polygons.push_back(std::move(poly));
 			}
 
-			mesh.buckets.push_back(bucket);
+			mesh.buckets.push_back(std::move(bucket));
 		}
 
-		g_Level.Meshes.push_back(mesh);
+		g_Level.Meshes.push_back(std::move(mesh));
 	}
 
 	int numAnimations = ReadInt32();
@@ -322,10 +337,11 @@ void LoadObjects()
 	ReadBytes(g_Level.Bones.data(), 4 * numBones);
 
 	int numFrames = ReadInt32();
-	g_Level.Frames.resize(numFrames);
+	g_Level.Frames.reserve(numFrames);
 	for (int i = 0; i < numFrames; i++)
 	{
-		auto* frame = &g_Level.Frames[i];
+		// NOTE: Orientation vector is bound to level arena on construction, as assignment would keep default allocator.
+		auto* frame = &g_Level.Frames.emplace_back(AnimFrame{ GameBoundingBox::Zero, Vector3::Zero, std::pmr::vector<Quaternion>(&g_LevelArena) });
 
 		frame->BoundingBox.X1 = ReadInt16();
 		frame->BoundingBox.X2 = ReadInt16();
@@ -337,16 +353,10 @@ void LoadObjects()
 		// NOTE: Braces are necessary to ensure correct value init order.
 		frame->Offset = Vector3{ (float)ReadInt16(), (float)ReadInt16(), (float)ReadInt16() };
 
+		// Orientations are stored as packed XYZW floats, matching Quaternion layout.
 		int numAngles = ReadInt16();
 		frame->BoneOrientations.resize(numAngles);
-		for (int j = 0; j < numAngles; j++)
-		{
-			auto* q = &frame->BoneOrientations[j];
-			q->x = ReadFloat();
-			q->y = ReadFloat();
-			q->z = ReadFloat();
-			q->w = ReadFloat();
-		}
+		ReadBytes(frame->BoneOrientations.data(), sizeof(Quaternion) * numAngles);
 	}
 
 	int numModels = ReadInt32();
@@ -634,38 +644,17 @@ void ReadRooms()
 			bucket.polygons.reserve(numPolygons);
 			for (int k = 0; k < numPolygons; k++)
 			{
-				POLYGON poly;
-				
-				poly.shape = ReadInt32();
-				poly.animatedSequence = ReadInt32();
-				poly.animatedFrame = ReadInt32();
-				int count = (poly.shape == 0 ? 4 : 3);
-				poly.indices.resize(count);
-				poly.textureCoordinates.resize(count);
-				poly.normals.resize(count);
-				poly.tangents.resize(count);
-				poly.bitangents.resize(count);
-
-				for (int n = 0; n < count; n++)
-					poly.indices[n] = ReadInt32();
-				for (int n = 0; n < count; n++)
-					poly.textureCoordinates[n] = ReadVector2();
-				for (int n = 0; n < count; n++)
-					poly.normals[n] = ReadVector3();
-				for (int n = 0; n < count; n++)
-					poly.tangents[n] = ReadVector3();
-				for (int n = 0; n < count; n++)
-					poly.bitangents[n] = ReadVector3();
-
-				bucket.polygons.push_back(poly);
+				auto poly = ReadPolygon(false);
 
 				if (poly.shape == 0)
 					bucket.numQuads++;
 				else
 					bucket.numTriangles++;
+
+				bucket.polygons.push_back(std::move(poly));
 			}
 
-			room.buckets.push_back(bucket);
+			room.buckets.push_back(std::move(bucket));
 		}
 
 		int numPortals = ReadInt32();
@@ -824,9 +813,17 @@ void LoadRooms()
 	ReadRooms();
 	BuildOutsideRoomsTable();
 
+	int numSectors = 0;
+	for (const auto& room : g_Level.Rooms)
+		numSectors += (int)room.floor.size();
+
+	TENLog("Num sectors: " + std::to_string(numSectors) + " (" + std::to_string((numSectors * sizeof(FloorInfo)) / 1024) + " KB)", LogLevel::Info);
+
 	int numFloorData = ReadInt32(); 
 	g_Level.FloorData.resize(numFloorData);
 	ReadBytes(g_Level.FloorData.data(), numFloorData * sizeof(short));
+
+	CompileTriggers();
 }
 
 void FreeLevel()
@@ -845,6 +842,7 @@ void FreeLevel()
 	g_Level.SpritesTextures.resize(0);
 	g_Level.AnimatedTexturesSequences.resize(0);
 	g_Level.Rooms.resize(0);
+	TEN::Floordata::ClearBridges();
 	g_Level.Bones.resize(0);
 	g_Level.Meshes.resize(0);
 	MoveablesIds.resize(0);
@@ -859,6 +857,7 @@ void FreeLevel()
 	g_Level.SoundDetails.resize(0);
 	g_Level.SoundMap.resize(0);
 	g_Level.FloorData.resize(0);
+	g_Level.Triggers.resize(0);
 	g_Level.Cameras.resize(0);
 	g_Level.Sinks.resize(0);
 	g_Level.SoundSources.resize(0);
@@ -877,6 +876,9 @@ void FreeLevel()
 	g_GameScriptEntities->FreeEntities();
 
 	FreeSamples();
+
+	// Level containers allocated from arena were destroyed above.
+	g_LevelArena.Release();
 }
 
 size_t ReadFileEx(void* ptr, size_t size, size_t count, FILE* stream)
@@ -1025,10 +1027,8 @@ bool Decompress(byte* dest, byte* src, unsigned long compressedSize, unsigned lo
 		return false;
 }
 
-unsigned int _stdcall LoadLevel(void* data)
+bool LoadLevel(int levelIndex)
 {
-	const int levelIndex = (int)reinterpret_cast<size_t>(data);
-
 	auto* level = g_GameFlow->GetLevel(levelIndex);
 
 	TENLog("Loading level file: " + level->FileName, LogLevel::Info);
@@ -1149,6 +1149,8 @@ unsigned int _stdcall LoadLevel(void* data)
 
 		g_Renderer.PrepareDataForTheRenderer();
 
+		TENLog("Level arena: " + std::to_string(g_LevelArena.GetAllocationCount()) + " allocations (" +
+			   std::to_string(g_LevelArena.GetAllocatedSize() / 1024) + " KB)", LogLevel::Info);
 		TENLog("Level loading complete.", LogLevel::Info);
 
 		SetScreenFadeOut(FADE_SCREEN_SPEED);
@@ -1175,9 +1177,6 @@ unsigned int _stdcall LoadLevel(void* data)
 		dataPtr = LevelDataPtr = nullptr;
 	}
 
-	// Level loaded
-	IsLevelLoading = false;
-	_endthreadex(1);
 	return LoadedSuccessfully;
 }
 
@@ -1276,19 +1275,14 @@ int LoadLevelFile(int levelIndex)
 	CleanUp();
 	FreeLevel();
 	
-	// Loading level is done is two threads, one for loading level and one for drawing loading screen
+	// Level is loaded in a separate thread which also draws loading screen.
+	// Block on its result instead of spinning, so the game thread doesn't burn a core meanwhile.
 	IsLevelLoading = true;
 
-	_beginthreadex(
-		nullptr,
-		0, 
-		LoadLevel, 
-		reinterpret_cast<void*>((size_t)levelIndex), 
-		0, 
-		nullptr);
-
-	while (IsLevelLoading);
+	auto loadResult = std::async(std::launch::async, LoadLevel, levelIndex);
+	LoadedSuccessfully = loadResult.get();
 
+	IsLevelLoading = false;
 	return LoadedSuccessfully;
 }
 
@@ -1399,33 +1393,7 @@ void GetAIPickups()
 
 void BuildOutsideRoomsTable()
 {
-	for (int x = 0; x < OUTSIDE_SIZE; x++)
-	{
-		for (int z = 0; z < OUTSIDE_SIZE; z++)
-			OutsideRoomTable[x][z].clear();
-	}
-
-	for (int i = 0; i < g_Level.Rooms.size(); i++)
-	{
-		auto* room = &g_Level.Rooms[i];
-
-		int rx = (room->x / SECTOR(1));
-		int rz = (room->z / SECTOR(1));
-
-		for (int x = 0; x < OUTSIDE_SIZE; x++)
-		{
-			if (x < (rx + 1) || x > (rx + room->xSize - 2))
-				continue;
-
-			for (int z = 0; z < OUTSIDE_SIZE; z++)
-			{
-				if (z < (rz + 1) || z > (rz + room->zSize - 2))
-					continue;
-
-				OutsideRoomTable[x][z].push_back(i);
-			}
-		}
-	}
+	OutsideRooms.Build(g_Level.Rooms);
 }
 
 void LoadPortal(ROOM_INFO& room) 
@@ -1,5 +1,8 @@
 #pragma once
+#include <atomic>
+
 #include "Game/animation.h"
+#include "Game/control/trigger.h"
 #include "Game/control/volumeactivator.h"
 #include "Game/items.h"
 #include "Game/itemdata/creature_info.h"
@@ -98,6 +101,7 @@ struct LEVEL
 	TEXTURE SkyTexture;
 	std::vector<ROOM_INFO> Rooms;
 	std::vector<short> FloorData;
+	std::vector<TriggerRecord> Triggers;
 	std::vector<MESH> Meshes;
 	std::vector<int> Bones;
 	std::vector<AnimData> Anims;
@@ -123,7 +127,7 @@ struct LEVEL
 
 extern std::vector<int> MoveablesIds;
 extern std::vector<int> StaticObjectsIds;
-extern bool IsLevelLoading;
+extern std::atomic<bool> IsLevelLoading;
 extern LEVEL g_Level;
 
 size_t ReadFileEx(void* ptr, size_t size, size_t count, FILE* stream);
@@ -152,4 +156,4 @@ void GetCarriedItems();
 void GetAIPickups();
 void BuildOutsideRoomsTable();
 
-unsigned _stdcall LoadLevel(void* data);
+bool LoadLevel(int levelIndex);
@@ -0,0 +1,41 @@
+#include "framework.h"
+#include "Specific/memory/LevelArena.h"
+
+namespace TEN::Memory
+{
+	LevelArena g_LevelArena = {};
+
+	size_t LevelArena::GetAllocatedSize() const
+	{
+		return AllocatedSize;
+	}
+
+	unsigned int LevelArena::GetAllocationCount() const
+	{
+		return AllocationCount;
+	}
+
+	void LevelArena::Release()
+	{
+		Resource.release();
+		AllocatedSize = 0;
+		AllocationCount = 0;
+	}
+
+	void* LevelArena::do_allocate(size_t byteCount, size_t alignment)
+	{
+		AllocatedSize += byteCount;
+		AllocationCount++;
+		return Resource.allocate(byteCount, alignment);
+	}
+
+	void LevelArena::do_deallocate(void* ptr, size_t byteCount, size_t alignment)
+	{
+		// Memory is reclaimed only by Release().
+	}
+
+	bool LevelArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return (this == &other);
+	}
+}
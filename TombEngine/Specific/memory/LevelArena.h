@@ -0,0 +1,38 @@
+#pragma once
+#include <memory_resource>
+
+// Per-level memory arena.
+// Immutable level data is allocated monotonically from large blocks and released in one step when level is freed.
+// Containers allocated from arena must be destroyed before Release() is called.
+
+namespace TEN::Memory
+{
+	class LevelArena : public std::pmr::memory_resource
+	{
+	private:
+		// Constants
+		static constexpr auto BLOCK_SIZE_INITIAL = 1024 * 1024;
+
+		// Members
+		std::pmr::monotonic_buffer_resource Resource = std::pmr::monotonic_buffer_resource(BLOCK_SIZE_INITIAL);
+
+		size_t		 AllocatedSize	 = 0;
+		unsigned int AllocationCount = 0;
+
+	public:
+		// Getters
+		size_t		 GetAllocatedSize() const;
+		unsigned int GetAllocationCount() const;
+
+		// Utilities
+		void Release();
+
+	protected:
+		// Helpers
+		void* do_allocate(size_t byteCount, size_t alignment) override;
+		void  do_deallocate(void* ptr, size_t byteCount, size_t alignment) override;
+		bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+	};
+
+	extern LevelArena g_LevelArena;
+}
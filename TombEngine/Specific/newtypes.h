@@ -1,4 +1,6 @@
 #pragma once
+#include <memory_resource>
+
 #include "framework.h"
 #include "Renderer/Renderer11Enums.h"
 
@@ -14,11 +16,11 @@ struct POLYGON
 	int animatedSequence;
 	int animatedFrame;
 	float shineStrength;
-	std::vector<int> indices;
-	std::vector<Vector2> textureCoordinates;
-	std::vector<Vector3> normals;
-	std::vector<Vector3> tangents;
-	std::vector<Vector3> bitangents;
+	std::pmr::vector<int> indices; // Level arena allocated.
+	std::pmr::vector<Vector2> textureCoordinates;
+	std::pmr::vector<Vector3> normals;
+	std::pmr::vector<Vector3> tangents;
+	std::pmr::vector<Vector3> bitangents;
 };
 
 struct BUCKET
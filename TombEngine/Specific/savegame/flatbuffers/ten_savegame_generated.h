@@ -6687,6 +6687,8 @@ struct SaveGameT : public flatbuffers::NativeTable {
   std::unique_ptr<TEN::Save::UnionVecT> script_vars{};
   std::vector<std::string> callbacks_pre_control{};
   std::vector<std::string> callbacks_post_control{};
+  std::vector<uint32_t> random_state{};
+  std::vector<uint8_t> script_vars_data{};
 };
 
 struct SaveGame FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -6734,7 +6736,9 @@ struct SaveGame FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_CALL_COUNTERS = 78,
     VT_SCRIPT_VARS = 80,
     VT_CALLBACKS_PRE_CONTROL = 82,
-    VT_CALLBACKS_POST_CONTROL = 84
+    VT_CALLBACKS_POST_CONTROL = 84,
+    VT_RANDOM_STATE = 86,
+    VT_SCRIPT_VARS_DATA = 88
   };
   const TEN::Save::SaveGameHeader *header() const {
     return GetPointer<const TEN::Save::SaveGameHeader *>(VT_HEADER);
@@ -6859,6 +6863,12 @@ struct SaveGame FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *callbacks_post_control() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_CALLBACKS_POST_CONTROL);
   }
+  const flatbuffers::Vector<uint32_t> *random_state() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_RANDOM_STATE);
+  }
+  const flatbuffers::Vector<uint8_t> *script_vars_data() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_SCRIPT_VARS_DATA);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_HEADER) &&
@@ -6949,6 +6959,10 @@ struct SaveGame FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_CALLBACKS_POST_CONTROL) &&
            verifier.VerifyVector(callbacks_post_control()) &&
            verifier.VerifyVectorOfStrings(callbacks_post_control()) &&
+           VerifyOffset(verifier, VT_RANDOM_STATE) &&
+           verifier.VerifyVector(random_state()) &&
+           VerifyOffset(verifier, VT_SCRIPT_VARS_DATA) &&
+           verifier.VerifyVector(script_vars_data()) &&
            verifier.EndTable();
   }
   SaveGameT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -7083,6 +7097,12 @@ struct SaveGameBuilder {
   void add_callbacks_post_control(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> callbacks_post_control) {
     fbb_.AddOffset(SaveGame::VT_CALLBACKS_POST_CONTROL, callbacks_post_control);
   }
+  void add_random_state(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> random_state) {
+    fbb_.AddOffset(SaveGame::VT_RANDOM_STATE, random_state);
+  }
+  void add_script_vars_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> script_vars_data) {
+    fbb_.AddOffset(SaveGame::VT_SCRIPT_VARS_DATA, script_vars_data);
+  }
   explicit SaveGameBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -7136,10 +7156,14 @@ inline flatbuffers::Offset<SaveGame> CreateSaveGame(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<TEN::Save::EventSetCallCounters>>> call_counters = 0,
     flatbuffers::Offset<TEN::Save::UnionVec> script_vars = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> callbacks_pre_control = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> callbacks_post_control = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> callbacks_post_control = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> random_state = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> script_vars_data = 0) {
   SaveGameBuilder builder_(_fbb);
   builder_.add_oneshot_position(oneshot_position);
   builder_.add_ambient_position(ambient_position);
+  builder_.add_script_vars_data(script_vars_data);
+  builder_.add_random_state(random_state);
   builder_.add_callbacks_post_control(callbacks_post_control);
   builder_.add_callbacks_pre_control(callbacks_pre_control);
   builder_.add_script_vars(script_vars);
@@ -7229,7 +7253,9 @@ inline flatbuffers::Offset<SaveGame> CreateSaveGameDirect(
     const std::vector<flatbuffers::Offset<TEN::Save::EventSetCallCounters>> *call_counters = nullptr,
     flatbuffers::Offset<TEN::Save::UnionVec> script_vars = 0,
     const std::vector<flatbuffers::Offset<flatbuffers::String>> *callbacks_pre_control = nullptr,
-    const std::vector<flatbuffers::Offset<flatbuffers::String>> *callbacks_post_control = nullptr) {
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *callbacks_post_control = nullptr,
+    const std::vector<uint32_t> *random_state = nullptr,
+    const std::vector<uint8_t> *script_vars_data = nullptr) {
   auto rooms__ = rooms ? _fbb.CreateVector<flatbuffers::Offset<TEN::Save::Room>>(*rooms) : 0;
   auto items__ = items ? _fbb.CreateVector<flatbuffers::Offset<TEN::Save::Item>>(*items) : 0;
   auto room_items__ = room_items ? _fbb.CreateVector<int32_t>(*room_items) : 0;
@@ -7253,6 +7279,8 @@ inline flatbuffers::Offset<SaveGame> CreateSaveGameDirect(
   auto call_counters__ = call_counters ? _fbb.CreateVector<flatbuffers::Offset<TEN::Save::EventSetCallCounters>>(*call_counters) : 0;
   auto callbacks_pre_control__ = callbacks_pre_control ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*callbacks_pre_control) : 0;
   auto callbacks_post_control__ = callbacks_post_control ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*callbacks_post_control) : 0;
+  auto random_state__ = random_state ? _fbb.CreateVector<uint32_t>(*random_state) : 0;
+  auto script_vars_data__ = script_vars_data ? _fbb.CreateVector<uint8_t>(*script_vars_data) : 0;
   return TEN::Save::CreateSaveGame(
       _fbb,
       header,
@@ -7295,7 +7323,9 @@ inline flatbuffers::Offset<SaveGame> CreateSaveGameDirect(
       call_counters__,
       script_vars,
       callbacks_pre_control__,
-      callbacks_post_control__);
+      callbacks_post_control__,
+      random_state__,
+      script_vars_data__);
 }
 
 flatbuffers::Offset<SaveGame> CreateSaveGame(flatbuffers::FlatBufferBuilder &_fbb, const SaveGameT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -9287,6 +9317,8 @@ inline void SaveGame::UnPackTo(SaveGameT *_o, const flatbuffers::resolver_functi
   { auto _e = script_vars(); if (_e) _o->script_vars = std::unique_ptr<TEN::Save::UnionVecT>(_e->UnPack(_resolver)); }
   { auto _e = callbacks_pre_control(); if (_e) { _o->callbacks_pre_control.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->callbacks_pre_control[_i] = _e->Get(_i)->str(); } } }
   { auto _e = callbacks_post_control(); if (_e) { _o->callbacks_post_control.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->callbacks_post_control[_i] = _e->Get(_i)->str(); } } }
+  { auto _e = random_state(); if (_e) { _o->random_state.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->random_state[_i] = _e->Get(_i); } } }
+  { auto _e = script_vars_data(); if (_e) { _o->script_vars_data.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->script_vars_data.begin()); } }
 }
 
 inline flatbuffers::Offset<SaveGame> SaveGame::Pack(flatbuffers::FlatBufferBuilder &_fbb, const SaveGameT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
@@ -9338,6 +9370,8 @@ inline flatbuffers::Offset<SaveGame> CreateSaveGame(flatbuffers::FlatBufferBuild
   auto _script_vars = _o->script_vars ? CreateUnionVec(_fbb, _o->script_vars.get(), _rehasher) : 0;
   auto _callbacks_pre_control = _fbb.CreateVectorOfStrings(_o->callbacks_pre_control);
   auto _callbacks_post_control = _fbb.CreateVectorOfStrings(_o->callbacks_post_control);
+  auto _random_state = _fbb.CreateVector(_o->random_state);
+  auto _script_vars_data = _fbb.CreateVector(_o->script_vars_data);
   return TEN::Save::CreateSaveGame(
       _fbb,
       _header,
@@ -9380,7 +9414,9 @@ inline flatbuffers::Offset<SaveGame> CreateSaveGame(flatbuffers::FlatBufferBuild
       _call_counters,
       _script_vars,
       _callbacks_pre_control,
-      _callbacks_post_control);
+      _callbacks_post_control,
+      _random_state,
+      _script_vars_data);
 }
 
 inline bool VerifyVarUnion(flatbuffers::Verifier &verifier, const void *obj, VarUnion type) {
@@ -352,6 +352,7 @@ void InitialiseObjects()
 		obj->usingDrawAnimatingItem = true;
 		obj->undead = false;
 		obj->LotType = LotType::Basic;
+		obj->tickPolicy = TickPolicy::Default;
 		obj->biteOffset = -1;
 		obj->meshSwapSlot = NO_ITEM;
 		obj->isPickup = false;
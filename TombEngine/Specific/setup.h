@@ -26,6 +26,16 @@ enum class LotType
 	Ape		   // Only 2 block vault allowed.
 };
 
+// Update scheduling policy for items of an object. Used by ItemScheduler in scheduler.cpp.
+// Skipped ticks are not caught up, so reduced rates are only for purely cosmetic objects which opt in.
+enum class TickPolicy
+{
+	Default,		  // EveryFrame.
+	EveryFrame,
+	DistanceLOD,	  // Update rate is reduced with distance while item's room is out of view.
+	SleepUntilVisible // Not updated while item's room is out of view, unless item was triggered.
+};
+
 enum JointRotationFlags
 {
 	ROT_X = (1 << 2),
@@ -57,6 +67,7 @@ struct ObjectInfo
 	int boneIndex;
 	int frameBase;
 	LotType LotType;
+	TickPolicy tickPolicy;
 	int animIndex;
 	short HitPoints;
 	short pivotLength;
@@ -9,6 +9,7 @@
 #include <filesystem>
 
 #include "Game/control/control.h"
+#include "Game/control/replay.h"
 #include "Game/savegame.h"
 #include "Renderer/Renderer11.h"
 #include "Sound/sound.h"
@@ -19,6 +20,7 @@
 #include "ScriptInterfaceState.h"
 #include "ScriptInterfaceLevel.h"
 
+using namespace TEN::Control::Replay;
 using namespace TEN::Renderer;
 using namespace TEN::Input;
 using namespace TEN::Utils;
@@ -242,6 +244,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 	// Process command line arguments
 	bool setup = false;
 	std::string levelFile = {};
+	std::string recordFile = {};
+	std::string replayFile = {};
 	LPWSTR* argv;
 	int argc;
 	argv = CommandLineToArgvW(GetCommandLineW(), &argc);
@@ -261,6 +265,14 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		{
 			levelFile = TEN::Utils::ToString(argv[i + 1]);
 		}
+		else if (ArgEquals(argv[i], "record") && argc > (i + 1))
+		{
+			recordFile = TEN::Utils::ToString(argv[i + 1]);
+		}
+		else if (ArgEquals(argv[i], "replay") && argc > (i + 1))
+		{
+			replayFile = TEN::Utils::ToString(argv[i + 1]);
+		}
 		else if (ArgEquals(argv[i], "hash") && argc > (i + 1))
 		{
 			SystemNameHash = std::stoul(std::wstring(argv[i + 1]));
@@ -288,6 +300,12 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 					   std::to_string(ver[2]));
 	TENLog(windowName, LogLevel::Info);
 
+	// Arm input recording or replay for next started level.
+	if (!replayFile.empty())
+		g_InputReplay.ArmPlayback(replayFile);
+	else if (!recordFile.empty())
+		g_InputReplay.ArmRecording(recordFile);
+
 	// Collect numbered tracks
 	EnumerateLegacyTracks();
 
@@ -369,6 +387,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		LoadConfiguration();
 	}
 
+	SetTENLogFlushPolicy(g_Configuration.LogFlushInterval, g_Configuration.LogFlushLevel);
+
 	// Setup window dimensions
 	RECT Rect;
 	Rect.left = 0;